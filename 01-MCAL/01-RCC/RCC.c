@@ -9,9 +9,12 @@
 
 #include "STD_TYPES.h"
 
+#include "FLASH.h"
+
 #include "RCC.h"
+#include "RCC_cfg.h"
 
-#define RCC_BASE_ADDRESS (uint32_t)0x40021000
+#define RCC_BASE_ADDRESS REG_BLOCK(0x40021000)
 
 #define SELECT_SYSTEM_CLOCK_CLEAR 0xFFFFFFFC
 #define GET_SYSTEM_CLOCK_CLEAR    0x0000000C
@@ -32,12 +35,31 @@
 #define PLL_MUL   0x003C0000
 
 #define AHB_PRESCALER   0x000000F0
+#define APB1_PRESCALER  0x00000700
+#define APB2_PRESCALER  0x00003800
+
+#define ADC_PRESCALER   0x0000C000
+
+#define APB1_PRESCALER_POS  8
+#define APB2_PRESCALER_POS  11
+#define ADC_PRESCALER_POS   14
+
+/* APB prescaler divides only if its high bit is set, the low bits give the power of 2 minus 1 */
+#define APB_DIVIDED     0x4
+#define APB_SHIFT_MASK  0x3
+
+/* SWS reports SW value shifted */
+#define SWS_POS         2
 
 #define PLL_SRC_POS     16
 #define PLL_XTPRE_POS   17
 #define PLL_MUL_POS     18
 
 #define PLL_MUL_BIN_DEC_DIFFERENCE  2
+#define PLL_MUL_MAX                 16
+
+/* Polls of clock bring up before it times out, rounded up */
+#define BRINGUP_TIMEOUT_POLLS  ((RCC_BRINGUP_TIMEOUT_US + RCC_BRINGUP_POLL_PERIOD_US - 1) / RCC_BRINGUP_POLL_PERIOD_US)
 
 #define READY_STATE_HSI 0x00000002
 #define READY_STATE_HSE 0x00020000
@@ -45,6 +67,17 @@
 
 #define HSI_TRIMMING 3
 
+/* Ready interrupts enables, flags and clear bits in CIR */
+#define CIR_HSERDYF  0x00000008
+#define CIR_PLLRDYF  0x00000010
+#define CIR_HSERDYIE 0x00000800
+#define CIR_PLLRDYIE 0x00001000
+#define CIR_HSERDYC  0x00080000
+#define CIR_PLLRDYC  0x00100000
+
+#define RESET_FLAGS_MASK 0xFC000000
+#define CSR_RMVF         0x01000000
+
 #define HSI_VALUE           ((uint32_t)8000000)
 #define HSE_VALUE           ((uint32_t)8000000)
 
@@ -64,48 +97,106 @@ typedef struct {
 
 volatile peripheral_t * RCC = (peripheral_t *) RCC_BASE_ADDRESS;
 
+/* Subscribers to clock changes, free slots are 0 */
+static rccClockCBF_t clockCallbacks[RCC_MAX_CLOCK_CALLBACKS];
 
-/* This function takes system_clock_x and selects it as system clock */
-status_t RCC_selectSystemClock (uint32_t clock)
+/* CFGR and CR bits of a profile from its options */
+#define PROFILE_PLL_SRC(source)        (((source) == PLL_SRC_HSE) ? PLL_SRC : 0)
+#define PROFILE_PLL_XTPRE(divider)     (((divider) == PLLXTPRE_HSE_CLK_DIVIDED) ? PLL_XTPRE : 0)
+#define PROFILE_USB(scale)             (((scale) == SCALER_USB_PLL_NOT_DIVIDED) ? USB_PRESCALER : 0)
+#define PROFILE_HSE(clock, source)     (((clock) == SYSTEM_CLOCK_HSE || ((clock) == SYSTEM_CLOCK_PLL && (source) == PLL_SRC_HSE)) ? SET_HSE_STATUS : 0)
+#define PROFILE_PLL(clock)             (((clock) == SYSTEM_CLOCK_PLL) ? SET_PLL_STATUS : 0)
+
+typedef struct
 {
-	status_t status = status_Ok;
+	/* CFGR of the profile with HSI selected */
+	uint32_t cfgr;
+	/* Clocks to start besides HSI, SET_x_STATUS */
+	uint32_t cr;
+	uint32_t clock;
+	uint32_t flashLatency;
+	uint32_t prefetch;
+
+}rccProfile_t;
+
+#define RCC_PROFILE(name, clock, pllSource, hseDivider, pllMul, ahbScaler, apb1Scaler, apb2Scaler, adcScaler, usbScaler, flashLatency, prefetch) \
+	{PROFILE_PLL_SRC(pllSource) | PROFILE_PLL_XTPRE(hseDivider) | (pllMul) | (ahbScaler) | (apb1Scaler) | \
+			(apb2Scaler) | (adcScaler) | PROFILE_USB(usbScaler), \
+			PROFILE_HSE(clock, pllSource) | PROFILE_PLL(clock), clock, flashLatency, prefetch},
+static const rccProfile_t rccProfiles[RCC_PROFILES_NUMBER] = {
+		RCC_PROFILES_LIST
+};
+#undef RCC_PROFILE
+
+/* Clock bring up in progress */
+static volatile uint32_t bringUpState = RCC_BRINGUP_IDLE;
+static uint32_t bringUpClock;
+static uint32_t bringUpPolls;
+static rccBringUpCBF_t bringUpCallback;
+
+/* Clock tree as last configured, getters read it without decoding CFGR */
+static rccClocks_t clockTree;
+static uint8_t clockTreeValid;
+
+/* This function computes PLL output frequency from a CFGR value */
+static uint32_t RCC_computePLL_Frequency (uint32_t cfgr)
+{
+	uint32_t tempFreq;
+	uint32_t temp;
+
+	/*
+      PLL output depends on:
+      1- PLL source which can be HSI/2, HSE, HSE/2
+      2- PLL multiplication factor
+	 */
 
-	if (clock == SYSTEM_CLOCK_HSI || clock == SYSTEM_CLOCK_HSE || clock == SYSTEM_CLOCK_PLL )
+	/* Checking PLL entry clock source */
+	temp = ((cfgr & PLL_SRC) >> PLL_SRC_POS) & 1;
+
+	/* HSI/2 is selected as PLL source */
+	if (temp == 0)
 	{
-		uint32_t temp;
-		temp = (RCC->CFGR) & SELECT_SYSTEM_CLOCK_CLEAR;
-		temp |= clock;
-		RCC->CFGR = temp;
+		tempFreq = HSI_VALUE / 2;
 	}
+	/* HSE is selected as PLL source */
 	else
 	{
-		status =  status_Nok;
-	}
+		/* Checking HSE divider for PLL entry */
+		temp = ((cfgr & PLL_XTPRE) >> PLL_XTPRE_POS) & 1;
 
-	return status;
-}
-
-/* This function takes nothing and return the selected clock for system */
-status_t RCC_getSystemClock(uint32_t *clockStatus)
-{
-	status_t status = status_Ok;
+		/* HSE clock not divided */
+		if (temp == 0)
+		{
+			tempFreq = HSE_VALUE;
+		}
+		/* HSE clock divided by 2 */
+		else
+		{
+			tempFreq = HSE_VALUE/2;
+		}
+	}
 
-	*clockStatus = RCC->CFGR & GET_SYSTEM_CLOCK_CLEAR;
+	/* Reading PLL MUL value */
+	temp = (cfgr & PLL_MUL) >> PLL_MUL_POS;
+	/* Real decimal values are +2 larger than binaries, the last two values are both x16 */
+	temp = temp + PLL_MUL_BIN_DEC_DIFFERENCE;
+	if (temp > PLL_MUL_MAX)
+	{
+		temp = PLL_MUL_MAX;
+	}
 
-	return status;
+	return tempFreq * temp;
 }
 
-/* This function shall return system frequency */
-status_t RCC_getSystemFrequency (uint32_t * systemFreq)
+/* This function computes clock tree frequencies from a CFGR value with source as SWS_x_SELECTED */
+static status_t RCC_computeClocks (uint32_t cfgr, uint32_t source, rccClocks_t * clocks)
 {
 	status_t status = status_Ok;
 
-	uint32_t currentClock, tempFreq;
+	uint32_t tempFreq = 0;
 	uint32_t temp;
-	/* Reading current system clock SWS */
-	currentClock = RCC->CFGR & GET_SYSTEM_CLOCK_CLEAR;
 
-	switch (currentClock)
+	switch (source)
 	{
 	case SWS_HSI_SELECTED:
 	{
@@ -120,52 +211,18 @@ status_t RCC_getSystemFrequency (uint32_t * systemFreq)
 	}
 	case SWS_PLL_SELECTED:
 	{
-		/*
-          In case PLL is selected as system clock source, must check:
-          1- PLL source which can be HSI/2, HSE, HSE/2
-          2- PLL multiplication factor
-		 */
-
-		/* Checking PLL entry clock source */
-		temp = ((RCC->CFGR & PLL_SRC) >> PLL_SRC_POS) & 1;
-
-		/* HSI/2 is selected as PLL source */
-		if (temp == 0)
-		{
-			tempFreq = HSI_VALUE / 2;
-		}
-		/* HSE is selected as PLL source */
-		else
-		{
-			/* Checking HSE divider for PLL entry */
-			temp = ((RCC->CFGR & PLL_XTPRE) >> PLL_XTPRE_POS) & 1;
-
-			/* HSE clock not divided */
-			if (temp == 0)
-			{
-				tempFreq = HSE_VALUE;
-			}
-			/* HSE clock divided by 2 */
-			else
-			{
-				tempFreq = HSE_VALUE/2;
-			}
-		}
-
-		/* Reading PLL MUL value */
-		temp = (RCC->CFGR & PLL_MUL) >> PLL_MUL_POS;
-		/* Real decimal values are +2 larger than binaries */
-		temp = temp + PLL_MUL_BIN_DEC_DIFFERENCE;
-
-		tempFreq = tempFreq * temp;
+		tempFreq = RCC_computePLL_Frequency(cfgr);
 		break;
 	}
 	default:
 		status = status_Nok;
 	}
 
+	clocks->sysclkSource = source >> SWS_POS;
+	clocks->sysclkFreq = tempFreq;
+
 	/*AHB Prescaler */
-	temp = RCC->CFGR & AHB_PRESCALER;
+	temp = cfgr & AHB_PRESCALER;
 	switch (temp)
 	{
 	case SCALER_AHB_2:    tempFreq = tempFreq / 2;   break;
@@ -178,7 +235,182 @@ status_t RCC_getSystemFrequency (uint32_t * systemFreq)
 	case SCALER_AHB_512:  tempFreq = tempFreq / 512; break;
 	}
 
-	*systemFreq = tempFreq;
+	clocks->ahbFreq = tempFreq;
+
+	/* APB prescalers */
+	temp = (cfgr & APB1_PRESCALER) >> APB1_PRESCALER_POS;
+	clocks->apb1Freq = (temp & APB_DIVIDED) ? tempFreq >> ((temp & APB_SHIFT_MASK) + 1) : tempFreq;
+
+	temp = (cfgr & APB2_PRESCALER) >> APB2_PRESCALER_POS;
+	clocks->apb2Freq = (temp & APB_DIVIDED) ? tempFreq >> ((temp & APB_SHIFT_MASK) + 1) : tempFreq;
+
+	/* ADC prescaler divides PCLK2 by 2, 4, 6 or 8 */
+	temp = (cfgr & ADC_PRESCALER) >> ADC_PRESCALER_POS;
+	clocks->adcFreq = clocks->apb2Freq / ((temp + 1) * 2);
+
+	/* USB clock is PLL clock divided by 1.5 unless USB prescaler is set */
+	temp = RCC_computePLL_Frequency(cfgr);
+	clocks->usbFreq = (cfgr & USB_PRESCALER) ? temp : (temp * 2) / 3;
+
+	return status;
+}
+
+/* This function calls every subscriber with the clock change event */
+static void RCC_notifyClockChange (uint32_t event, const rccClocks_t * clocks)
+{
+	uint32_t local_callbackLoop;
+
+	for (local_callbackLoop = 0; local_callbackLoop < RCC_MAX_CLOCK_CALLBACKS; local_callbackLoop++)
+	{
+		if (clockCallbacks[local_callbackLoop])
+		{
+			clockCallbacks[local_callbackLoop](event, clocks);
+		}
+	}
+}
+
+/* This function returns the clock tree, it is decoded from registers the first time only */
+static const rccClocks_t * RCC_getClockTree (void)
+{
+	if (!clockTreeValid)
+	{
+		RCC_computeClocks(RCC->CFGR, RCC->CFGR & GET_SYSTEM_CLOCK_CLEAR, &clockTree);
+		clockTreeValid = 1;
+	}
+
+	return &clockTree;
+}
+
+/* This function returns 1 if any clock of the tree differs */
+static uint8_t RCC_isClockTreeChanged (const rccClocks_t * oldClocks, const rccClocks_t * newClocks)
+{
+	return (oldClocks->sysclkSource != newClocks->sysclkSource ||
+			oldClocks->sysclkFreq != newClocks->sysclkFreq || oldClocks->ahbFreq != newClocks->ahbFreq ||
+			oldClocks->apb1Freq != newClocks->apb1Freq || oldClocks->apb2Freq != newClocks->apb2Freq ||
+			oldClocks->adcFreq != newClocks->adcFreq || oldClocks->usbFreq != newClocks->usbFreq);
+}
+
+/* This function computes the clock tree of a CFGR value and notifies subscribers before it applies, it returns 1 if they were notified */
+static uint8_t RCC_announceClocks (uint32_t cfgr, rccClocks_t * newClocks)
+{
+	uint8_t changed;
+
+	/* Source the hardware switches to, SWS follows SW once it is done */
+	RCC_computeClocks(cfgr, (cfgr & ~SELECT_SYSTEM_CLOCK_CLEAR) << SWS_POS, newClocks);
+
+	changed = RCC_isClockTreeChanged(RCC_getClockTree(), newClocks);
+	if (changed)
+	{
+		RCC_notifyClockChange(RCC_CLOCK_PRE_CHANGE, newClocks);
+	}
+
+	return changed;
+}
+
+/* This function keeps the clock tree in effect and notifies subscribers after it applies, also when they were notified before */
+static void RCC_commitClocks (const rccClocks_t * newClocks, uint8_t announced)
+{
+	uint8_t changed = RCC_isClockTreeChanged(RCC_getClockTree(), newClocks);
+
+	clockTree = *newClocks;
+
+	if (announced || changed)
+	{
+		RCC_notifyClockChange(RCC_CLOCK_POST_CHANGE, newClocks);
+	}
+}
+
+/* This function writes CFGR value and waits for the switch, subscribers are not notified */
+static void RCC_writeClocks (uint32_t cfgr)
+{
+	RCC->CFGR = cfgr;
+	REG_WAIT_WHILE((RCC->CFGR & GET_SYSTEM_CLOCK_CLEAR) != ((cfgr & ~SELECT_SYSTEM_CLOCK_CLEAR) << SWS_POS));
+}
+
+/* This function writes CFGR value and updates clock tree, subscribers are notified before and after clocks change */
+static void RCC_changeClocks (uint32_t cfgr)
+{
+	rccClocks_t newClocks;
+	uint8_t announced;
+
+	announced = RCC_announceClocks(cfgr, &newClocks);
+	RCC_writeClocks(cfgr);
+	RCC_commitClocks(&newClocks, announced);
+}
+
+
+/* This function takes system_clock_x and selects it as system clock, it returns after the switch and Nok if the clock is not ready */
+status_t RCC_selectSystemClock (uint32_t clock)
+{
+	status_t status = status_Ok;
+
+	/* Hardware switches only to a ready clock, so a clock that is not ready is refused */
+	if ((clock == SYSTEM_CLOCK_HSI && (RCC->CR & READY_STATE_HSI)) ||
+			(clock == SYSTEM_CLOCK_HSE && (RCC->CR & READY_STATE_HSE)) ||
+			(clock == SYSTEM_CLOCK_PLL && (RCC->CR & READY_STATE_PLL)))
+	{
+		uint32_t temp;
+		temp = (RCC->CFGR) & SELECT_SYSTEM_CLOCK_CLEAR;
+		temp |= clock;
+		RCC_changeClocks(temp);
+	}
+	else
+	{
+		status =  status_Nok;
+	}
+
+	return status;
+}
+
+/* This function takes nothing and return the selected clock for system */
+status_t RCC_getSystemClock(uint32_t *clockStatus)
+{
+	status_t status = status_Ok;
+
+	*clockStatus = RCC->CFGR & GET_SYSTEM_CLOCK_CLEAR;
+
+	return status;
+}
+
+/* This function shall return system frequency */
+status_t RCC_getSystemFrequency (uint32_t * systemFreq)
+{
+	status_t status = status_Ok;
+
+	*systemFreq = RCC_getClockTree()->ahbFreq;
+
+	return status;
+}
+
+/* This function takes RCC_FREQ_x and returns its frequency in Hz */
+status_t RCC_getClockFrequency (uint32_t clock, uint32_t * freq)
+{
+	status_t status = status_Ok;
+
+	const rccClocks_t * clocks = RCC_getClockTree();
+
+	switch (clock)
+	{
+	case RCC_FREQ_SYSCLK: *freq = clocks->sysclkFreq; break;
+	case RCC_FREQ_HCLK:   *freq = clocks->ahbFreq;    break;
+	case RCC_FREQ_PCLK1:  *freq = clocks->apb1Freq;   break;
+	case RCC_FREQ_PCLK2:  *freq = clocks->apb2Freq;   break;
+	case RCC_FREQ_ADCCLK: *freq = clocks->adcFreq;    break;
+	case RCC_FREQ_USBCLK: *freq = clocks->usbFreq;    break;
+	default:
+		status = status_Nok;
+	}
+
+	return status;
+}
+
+/* This function copies all frequencies of the clock tree */
+status_t RCC_getClocks (rccClocks_t * clocks)
+{
+	status_t status = status_Ok;
+
+	*clocks = *RCC_getClockTree();
+
 	return status;
 }
 /* This function takes set_x_status and sets its state Enabled or Disabled, it takes state_x*/
@@ -190,19 +422,20 @@ status_t RCC_setClockStatus (uint32_t clock, uint32_t state)
 	{
 		if (state == STATE_ENABLE)
 		{
+			uint32_t ready;
+			uint32_t polls = 0;
+
 			RCC->CR |= clock;
 
-			if (clock == SET_HSI_STATUS)
-			{
-				while (!(RCC->CR & READY_STATE_HSI));
-			}
-			else if (clock == SET_HSE_STATUS)
-			{
-				while (!(RCC->CR & READY_STATE_HSE));
-			}
-			else if (clock == SET_PLL_STATUS)
+			/* Ready flag is the bit after the enable bit */
+			ready = clock << 1;
+			REG_WAIT_WHILE(!(RCC->CR & ready) && ++polls < RCC_READY_TIMEOUT_POLLS);
+
+			/* A clock that does not start, as a dead crystal, is stopped */
+			if (!(RCC->CR & ready))
 			{
-				while (!(RCC->CR & READY_STATE_PLL));
+				RCC->CR &= ~clock;
+				status = status_Nok;
 			}
 		}
 
@@ -269,11 +502,11 @@ status_t RCC_selectPLL_Source (uint32_t source)
 	{
 		if (source == PLL_SRC_HSI)
 		{
-			RCC->CFGR &= ~PLL_SRC;
+			RCC_changeClocks(RCC->CFGR & ~PLL_SRC);
 		}
 		else if (source == PLL_SRC_HSE)
 		{
-			RCC->CFGR |= PLL_SRC;
+			RCC_changeClocks(RCC->CFGR | PLL_SRC);
 		}
 		else
 		{
@@ -296,11 +529,11 @@ status_t RCC_setPLL_HSE_Divider (uint32_t PLLXTPRE)
 	{
 		if (PLLXTPRE == PLLXTPRE_HSE_CLK_NOT_DIVIDED)
 		{
-			RCC->CFGR &= ~PLL_XTPRE;
+			RCC_changeClocks(RCC->CFGR & ~PLL_XTPRE);
 		}
 		else if ( PLLXTPRE == PLLXTPRE_HSE_CLK_DIVIDED)
 		{
-			RCC->CFGR |= PLLXTPRE;
+			RCC_changeClocks(RCC->CFGR | PLL_XTPRE);
 		}
 		else
 		{
@@ -327,7 +560,7 @@ status_t RCC_setPLL_Multiplication (uint32_t mul_value)
 		uint32_t temp;
 		temp = RCC->CFGR & PLL_MUL_CLEAR;
 		temp |= mul_value;
-		RCC->CFGR = temp;
+		RCC_changeClocks(temp);
 
 	}
 	else
@@ -382,12 +615,12 @@ status_t RCC_setAHB_Prescaler (uint32_t scale)
 {
 	status_t status = status_Ok;
 
-	if (scale == SCALER_AHB_2 ||scale == SCALER_AHB_4 ||scale == SCALER_AHB_8 ||scale == SCALER_AHB_16 ||scale == SCALER_AHB_64 ||scale == SCALER_AHB_128 ||scale == SCALER_AHB_256 ||scale == SCALER_AHB_512)
+	if (scale == SCALER_AHB_1 || scale == SCALER_AHB_2 ||scale == SCALER_AHB_4 ||scale == SCALER_AHB_8 ||scale == SCALER_AHB_16 ||scale == SCALER_AHB_64 ||scale == SCALER_AHB_128 ||scale == SCALER_AHB_256 ||scale == SCALER_AHB_512)
 	{
 		uint32_t temp;
 		temp = RCC->CFGR & AHB_SCALER_CLEAR;
 		temp |= scale;
-		RCC->CFGR = temp;
+		RCC_changeClocks(temp);
 
 	}
 	else
@@ -402,12 +635,12 @@ status_t RCC_setAPB1_Prescaler (uint32_t scale)
 {
 	status_t status = status_Ok;
 
-	if (scale == SCALER_APB1_2 ||scale == SCALER_APB1_4 ||scale == SCALER_APB1_8 ||scale == SCALER_APB1_16)
+	if (scale == SCALER_APB1_1 || scale == SCALER_APB1_2 ||scale == SCALER_APB1_4 ||scale == SCALER_APB1_8 ||scale == SCALER_APB1_16)
 	{
 		uint32_t temp;
 		temp = RCC->CFGR & APB1_SCALER_CLEAR;
 		temp |= scale;
-		RCC->CFGR = temp;
+		RCC_changeClocks(temp);
 
 	}
 	else
@@ -423,12 +656,12 @@ status_t RCC_setAPB2_Prescaler (uint32_t scale)
 {
 	status_t status = status_Ok;
 
-	if (scale == SCALER_APB2_2 ||scale == SCALER_APB2_4 ||scale == SCALER_APB2_8 ||scale == SCALER_APB2_16)
+	if (scale == SCALER_APB2_1 || scale == SCALER_APB2_2 ||scale == SCALER_APB2_4 ||scale == SCALER_APB2_8 ||scale == SCALER_APB2_16)
 	{
 		uint32_t temp;
 		temp = RCC->CFGR & APB2_SCALER_CLEAR;
 		temp |= scale;
-		RCC->CFGR = temp;
+		RCC_changeClocks(temp);
 
 	}
 	else
@@ -448,7 +681,7 @@ status_t RCC_setADC_Prescaler (uint32_t scale)
 		uint32_t temp;
 		temp = RCC->CFGR & ADC_SCALER_CLEAR;
 		temp |= scale;
-		RCC->CFGR = temp;
+		RCC_changeClocks(temp);
 	}
 	else
 	{
@@ -467,11 +700,11 @@ status_t RCC_setUBS_Prescaler (uint32_t scale)
 
 	if (scale == SCALER_USB_PLL_NOT_DIVIDED)
 	{
-		RCC->CFGR |= USB_PRESCALER;
+		RCC_changeClocks(RCC->CFGR | USB_PRESCALER);
 	}
 	else if (scale == SCALER_USB_PLL_DIVIDED)
 	{
-		RCC->CFGR &= ~USB_PRESCALER;
+		RCC_changeClocks(RCC->CFGR & ~USB_PRESCALER);
 	}
 	else
 	{
@@ -522,3 +755,304 @@ status_t RCC_setAPB2_PeripheralState (uint32_t peripheral, uint32_t state)
 
 	return status;
 }
+
+/* This function enables and disables peripherals on APB1 Bus, it takes  APB1ENR_x and state_x */
+status_t RCC_setAPB1_PeripheralState (uint32_t peripheral, uint32_t state)
+{
+	status_t status = status_Ok;
+
+	if (state == STATE_ENABLE)
+	{
+		RCC->APB1ENR |= peripheral;
+	}
+	else if (state == STATE_DISABLE)
+	{
+		RCC->APB1ENR &= ~peripheral;
+	}
+	else
+	{
+		status =  status_Nok;
+	}
+
+	return status;
+}
+
+/* This function gets causes of the last reset as RESET_FLAG_x bits, they are kept until cleared */
+status_t RCC_getResetFlags (uint32_t * flags)
+{
+	status_t status = status_Ok;
+
+	if (flags == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*flags = RCC->CSR & RESET_FLAGS_MASK;
+	}
+
+	return status;
+}
+
+/* This function clears reset flags so the next reset reports its own causes only */
+status_t RCC_clearResetFlags (void)
+{
+	status_t status = status_Ok;
+
+	RCC->CSR |= CSR_RMVF;
+
+	return status;
+}
+
+/* This function subscribes callback to changes of system clock and AHB/APB prescalers, it returns Nok if no slot is free */
+status_t RCC_registerClockCallback (rccClockCBF_t callbackFn)
+{
+	status_t status = status_Nok;
+	uint32_t local_callbackLoop;
+
+	if (callbackFn == 0)
+	{
+		return status_Nok;
+	}
+
+	/* A callback already subscribed keeps its slot */
+	for (local_callbackLoop = 0; local_callbackLoop < RCC_MAX_CLOCK_CALLBACKS; local_callbackLoop++)
+	{
+		if (clockCallbacks[local_callbackLoop] == callbackFn)
+		{
+			return status_Ok;
+		}
+	}
+
+	for (local_callbackLoop = 0; local_callbackLoop < RCC_MAX_CLOCK_CALLBACKS; local_callbackLoop++)
+	{
+		if (clockCallbacks[local_callbackLoop] == 0)
+		{
+			clockCallbacks[local_callbackLoop] = callbackFn;
+			status = status_Ok;
+			break;
+		}
+	}
+
+	return status;
+}
+
+/* This function unsubscribes callback from clock changes */
+status_t RCC_unregisterClockCallback (rccClockCBF_t callbackFn)
+{
+	status_t status = status_Nok;
+	uint32_t local_callbackLoop;
+
+	for (local_callbackLoop = 0; local_callbackLoop < RCC_MAX_CLOCK_CALLBACKS; local_callbackLoop++)
+	{
+		if (callbackFn != 0 && clockCallbacks[local_callbackLoop] == callbackFn)
+		{
+			clockCallbacks[local_callbackLoop] = 0;
+			status = status_Ok;
+		}
+	}
+
+	return status;
+}
+
+/* This function applies a clock profile of RCC_PROFILES_LIST */
+status_t RCC_applyProfile (uint32_t profile)
+{
+	status_t status = status_Ok;
+	const rccProfile_t * target;
+	uint32_t latency;
+
+	if (profile >= RCC_PROFILES_NUMBER)
+	{
+		return status_Nok;
+	}
+	target = &rccProfiles[profile];
+
+	/* HSI runs the steps of the switch, it is needed before anything changes */
+	if (RCC_setClockStatus(SET_HSI_STATUS, STATE_ENABLE) != status_Ok)
+	{
+		return status_Nok;
+	}
+
+	/* Flash keeps up with the faster of both clocks during the switch */
+	FLASH_getLatency(&latency);
+	if (target->flashLatency > latency)
+	{
+		FLASH_setLatency(target->flashLatency);
+	}
+
+	/* HSI undivided runs meanwhile, so every prescaler is safe and prefetch can be switched.
+	   Subscribers are told, HSE and PLL startup is counted at HSI speed */
+	RCC_changeClocks((RCC->CFGR & SELECT_SYSTEM_CLOCK_CLEAR & AHB_SCALER_CLEAR) | SYSTEM_CLOCK_HSI);
+	FLASH_setPrefetch(target->prefetch);
+
+	/* PLL is configured only while stopped, HSE is kept only if the profile needs it */
+	RCC->CR &= ~(SET_PLL_STATUS | (SET_HSE_STATUS & ~target->cr));
+
+	RCC_changeClocks(target->cfgr);
+
+	if (target->cr & SET_HSE_STATUS)
+	{
+		status = RCC_setClockStatus(SET_HSE_STATUS, STATE_ENABLE);
+	}
+	if (status == status_Ok && (target->cr & SET_PLL_STATUS))
+	{
+		status = RCC_setClockStatus(SET_PLL_STATUS, STATE_ENABLE);
+	}
+
+	/* Otherwise system stays on HSI with the profile prescalers, subscribers already have them */
+	if (status == status_Ok)
+	{
+		if (target->clock != SYSTEM_CLOCK_HSI)
+		{
+			RCC_changeClocks(target->cfgr | target->clock);
+		}
+
+		if (target->flashLatency < latency)
+		{
+			FLASH_setLatency(target->flashLatency);
+		}
+	}
+
+	return status;
+}
+
+/* This function ends clock bring up with its state */
+static void RCC_endBringUp (uint32_t state)
+{
+	RCC->CIR &= ~(CIR_HSERDYIE | CIR_PLLRDYIE);
+	bringUpState = state;
+
+	if (bringUpCallback)
+	{
+		bringUpCallback(state);
+	}
+}
+
+/* This function raises flash wait states for the system clock a CFGR value selects, before it is written */
+static void RCC_raiseFlashLatency (uint32_t cfgr)
+{
+	rccClocks_t newClocks;
+	uint32_t latency;
+	uint32_t needed;
+
+	RCC_computeClocks(cfgr, (cfgr & ~SELECT_SYSTEM_CLOCK_CLEAR) << SWS_POS, &newClocks);
+
+	FLASH_getLatency(&latency);
+	FLASH_getLatencyForClock(newClocks.sysclkFreq, &needed);
+	if (needed > latency)
+	{
+		FLASH_setLatency(needed);
+	}
+}
+
+/* This function moves clock bring up to its next step once the awaited clock is ready */
+static void RCC_advanceBringUp (void)
+{
+	if (bringUpState == RCC_BRINGUP_HSE && (RCC->CR & READY_STATE_HSE))
+	{
+		if (bringUpClock == SYSTEM_CLOCK_HSE)
+		{
+			RCC_raiseFlashLatency((RCC->CFGR & SELECT_SYSTEM_CLOCK_CLEAR) | SYSTEM_CLOCK_HSE);
+			RCC_selectSystemClock(SYSTEM_CLOCK_HSE);
+			RCC_endBringUp(RCC_BRINGUP_DONE);
+		}
+		else
+		{
+			bringUpState = RCC_BRINGUP_PLL;
+			bringUpPolls = 0;
+			RCC->CIR |= CIR_PLLRDYIE;
+			RCC->CR |= SET_PLL_STATUS;
+		}
+	}
+
+	if (bringUpState == RCC_BRINGUP_PLL && (RCC->CR & READY_STATE_PLL))
+	{
+		RCC_raiseFlashLatency((RCC->CFGR & SELECT_SYSTEM_CLOCK_CLEAR) | SYSTEM_CLOCK_PLL);
+		RCC_selectSystemClock(SYSTEM_CLOCK_PLL);
+		RCC_endBringUp(RCC_BRINGUP_DONE);
+	}
+}
+
+/* This function starts bringing up HSE or PLL as system clock without waiting */
+status_t RCC_startBringUp (uint32_t clock, rccBringUpCBF_t callbackFn)
+{
+	status_t status = status_Ok;
+	uint32_t primask;
+
+	if ((clock != SYSTEM_CLOCK_HSE && clock != SYSTEM_CLOCK_PLL) ||
+			bringUpState == RCC_BRINGUP_HSE || bringUpState == RCC_BRINGUP_PLL)
+	{
+		return status_Nok;
+	}
+
+	/* Clock callbacks run inside, interrupts are held until the caller's state is restored */
+	primask = CORE_GET_PRIMASK();
+	CORE_SET_PRIMASK(1);
+
+	bringUpClock = clock;
+	bringUpCallback = callbackFn;
+	bringUpPolls = 0;
+
+	/* Ready flags raised before this bring up are cleared */
+	RCC->CIR |= CIR_HSERDYC | CIR_PLLRDYC;
+
+	if (clock == SYSTEM_CLOCK_HSE || (RCC->CFGR & PLL_SRC))
+	{
+		bringUpState = RCC_BRINGUP_HSE;
+		RCC->CIR |= CIR_HSERDYIE;
+		RCC->CR |= SET_HSE_STATUS;
+	}
+	else
+	{
+		bringUpState = RCC_BRINGUP_PLL;
+		RCC->CIR |= CIR_PLLRDYIE;
+		RCC->CR |= SET_PLL_STATUS;
+	}
+
+	/* Clock may already be running */
+	RCC_advanceBringUp();
+
+	CORE_SET_PRIMASK(primask);
+
+	return status;
+}
+
+/* This function goes on with clock bring up and counts its timeout, it is called every RCC_BRINGUP_POLL_PERIOD_US */
+status_t RCC_pollBringUp (uint32_t * state)
+{
+	status_t status = status_Ok;
+	uint32_t primask = CORE_GET_PRIMASK();
+
+	CORE_SET_PRIMASK(1);
+
+	RCC_advanceBringUp();
+
+	if (bringUpState == RCC_BRINGUP_HSE || bringUpState == RCC_BRINGUP_PLL)
+	{
+		bringUpPolls++;
+		if (bringUpPolls >= BRINGUP_TIMEOUT_POLLS)
+		{
+			/* Clocks that did not start are stopped, system goes on from HSI */
+			RCC->CR |= SET_HSI_STATUS;
+			REG_WAIT_WHILE(!(RCC->CR & READY_STATE_HSI));
+			RCC_selectSystemClock(SYSTEM_CLOCK_HSI);
+			RCC->CR &= ~(SET_PLL_STATUS | SET_HSE_STATUS);
+			RCC_endBringUp(RCC_BRINGUP_FAILED);
+		}
+	}
+
+	*state = bringUpState;
+
+	CORE_SET_PRIMASK(primask);
+
+	return status;
+}
+
+/* RCC interrupt handler, ready interrupts move clock bring up on */
+void RCC_IRQHandler (void)
+{
+	RCC->CIR |= CIR_HSERDYC | CIR_PLLRDYC;
+
+	RCC_advanceBringUp();
+}
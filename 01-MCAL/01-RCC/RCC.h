@@ -57,6 +57,7 @@
 #define PLL_MUL_15  0x00340000
 #define PLL_MUL_16  0x00380000
 
+#define SCALER_AHB_1   0x00000000
 #define SCALER_AHB_2   0x00000080 
 #define SCALER_AHB_4   0x00000090 
 #define SCALER_AHB_8   0x000000A0 
@@ -66,11 +67,13 @@
 #define SCALER_AHB_256 0x000000E0 
 #define SCALER_AHB_512 0x000000F0 
 
+#define SCALER_APB1_1   0x00000000
 #define SCALER_APB1_2   0x00000400
 #define SCALER_APB1_4   0x00000500
 #define SCALER_APB1_8   0x00000600
 #define SCALER_APB1_16  0x00000700
 
+#define SCALER_APB2_1   0x00000000
 #define SCALER_APB2_2   0x00002000   
 #define SCALER_APB2_4   0x00002800    
 #define SCALER_APB2_8   0x00003000   
@@ -110,8 +113,71 @@
 #define APB2ENR_TIM10  0x00100000
 #define APB2ENR_TIM11  0x00200000
 
-
-/* This function takes system_clock_x and selects it as system clock */
+#define APB1ENR_TIM2   0x00000001
+#define APB1ENR_TIM3   0x00000002
+#define APB1ENR_TIM4   0x00000004
+#define APB1ENR_TIM5   0x00000008
+#define APB1ENR_TIM6   0x00000010
+#define APB1ENR_TIM7   0x00000020
+#define APB1ENR_WWDG   0x00000800
+#define APB1ENR_SPI2   0x00004000
+#define APB1ENR_SPI3   0x00008000
+#define APB1ENR_USART2 0x00020000
+#define APB1ENR_USART3 0x00040000
+#define APB1ENR_UART4  0x00080000
+#define APB1ENR_UART5  0x00100000
+#define APB1ENR_I2C1   0x00200000
+#define APB1ENR_I2C2   0x00400000
+#define APB1ENR_USB    0x00800000
+#define APB1ENR_CAN    0x02000000
+#define APB1ENR_BKP    0x08000000
+#define APB1ENR_PWR    0x10000000
+#define APB1ENR_DAC    0x20000000
+
+#define RESET_FLAG_PIN   0x04000000
+#define RESET_FLAG_POR   0x08000000
+#define RESET_FLAG_SOFT  0x10000000
+#define RESET_FLAG_IWDG  0x20000000
+#define RESET_FLAG_WWDG  0x40000000
+#define RESET_FLAG_LPWR  0x80000000
+
+#define RCC_CLOCK_PRE_CHANGE  1
+#define RCC_CLOCK_POST_CHANGE 2
+
+#define RCC_BRINGUP_IDLE    0
+#define RCC_BRINGUP_HSE     1
+#define RCC_BRINGUP_PLL     2
+#define RCC_BRINGUP_DONE    3
+#define RCC_BRINGUP_FAILED  4
+
+#define RCC_FREQ_SYSCLK 0
+#define RCC_FREQ_HCLK   1
+#define RCC_FREQ_PCLK1  2
+#define RCC_FREQ_PCLK2  3
+#define RCC_FREQ_ADCCLK 4
+#define RCC_FREQ_USBCLK 5
+
+/* Frequencies in Hz of the clock tree outputs and system clock source as SYSTEM_CLOCK_x */
+typedef struct
+{
+	uint32_t sysclkSource;
+	uint32_t sysclkFreq;
+	uint32_t ahbFreq;
+	uint32_t apb1Freq;
+	uint32_t apb2Freq;
+	uint32_t adcFreq;
+	uint32_t usbFreq;
+
+}rccClocks_t;
+
+/* Called with RCC_BRINGUP_DONE or RCC_BRINGUP_FAILED once clock bring up ends */
+typedef void (*rccBringUpCBF_t)(uint32_t state);
+
+/* Called with RCC_CLOCK_PRE_CHANGE before bus clocks change and RCC_CLOCK_POST_CHANGE after, clocks are the new ones */
+typedef void (*rccClockCBF_t)(uint32_t event, const rccClocks_t * clocks);
+
+
+/* This function takes system_clock_x and selects it as system clock, it returns after the switch and Nok if the clock is not ready */
 extern status_t RCC_selectSystemClock (uint32_t clock);
 
 /* This function takes pointer to hold the clock status as SWS_X_SELECTED*/
@@ -120,7 +186,13 @@ extern status_t RCC_getSystemClock(uint32_t *clockStatus);
 /* This function shall return system frequency */
 extern status_t RCC_getSystemFrequency (uint32_t * systemFreq);
 
-/* This function takes set_x_status and sets its state Enabled or Disabled, it takes state_x */
+/* This function takes RCC_FREQ_x and returns its frequency in Hz, the clock tree is kept by every configuration call */
+extern status_t RCC_getClockFrequency (uint32_t clock, uint32_t * freq);
+
+/* This function copies all frequencies of the clock tree */
+extern status_t RCC_getClocks (rccClocks_t * clocks);
+
+/* This function takes set_x_status and sets its state Enabled or Disabled, it takes state_x, it returns Nok and stops the clock if it is not ready in time */
 extern status_t RCC_setClockStatus (uint32_t clock, uint32_t state);
 
 /* This functuin selects MCO clock , it takes MCO_x_Clk and returns Ok/Nok */
@@ -167,4 +239,65 @@ extern status_t RCC_setAHB_PeripheralState (uint32_t peripheral, uint32_t state)
 /* This function enables and disables peripherals on APB2 Bus, it takes APB2ENR_x and state_x */
 extern status_t RCC_setAPB2_PeripheralState (uint32_t peripheral, uint32_t state);
 
+/* This function enables and disables peripherals on APB1 Bus, it takes APB1ENR_x and state_x */
+extern status_t RCC_setAPB1_PeripheralState (uint32_t peripheral, uint32_t state);
+
+/* This function gets causes of the last reset as RESET_FLAG_x bits, they are kept until cleared */
+extern status_t RCC_getResetFlags (uint32_t * flags);
+
+/* This function clears reset flags so the next reset reports its own causes only */
+extern status_t RCC_clearResetFlags (void);
+
+/* This function subscribes callback to changes of system clock and AHB/APB prescalers, it returns Nok if no slot is free */
+extern status_t RCC_registerClockCallback (rccClockCBF_t callbackFn);
+
+/* This function unsubscribes callback from clock changes */
+extern status_t RCC_unregisterClockCallback (rccClockCBF_t callbackFn);
+
+/*
+  Description: This function shall apply a clock profile of RCC_PROFILES_LIST. Subscribers are
+               notified before and after every clock tree system runs on, HSI included while HSE
+               and PLL start, so time kept on system clock does not drift. Flash wait states are raised first, system runs from HSI while
+               CFGR of the profile is written at once, HSE and PLL are started as needed, the
+               profile clock is selected and wait states are lowered last. Prefetch buffer is set
+               while HSI runs undivided. If a clock does not start, system is left on HSI with Nok
+
+  Input:
+        1- profile -> RCC_PROFILE_ID_x
+
+  Output: status_t
+
+ */
+extern status_t RCC_applyProfile (uint32_t profile);
+
+/*
+  Description: This function shall start bringing up SYSTEM_CLOCK_HSE or SYSTEM_CLOCK_PLL as system
+               clock without waiting, PLL shall be configured before. HSE is started first if the
+               clock needs it, then PLL, and the clock is selected once ready, with flash wait
+               states raised for it first. It goes on from RCC_pollBringUp or from RCC interrupt
+               once INT_RCC is enabled in NVIC. RCC_pollBringUp shall be called every
+               RCC_BRINGUP_POLL_PERIOD_US in both cases, as a dead crystal raises no interrupt: a
+               clock that is not ready within RCC_BRINGUP_TIMEOUT_US is stopped and HSI is selected
+
+  Input:
+        1- clock -> SYSTEM_CLOCK_HSE or SYSTEM_CLOCK_PLL
+        2- callbackFn -> called with RCC_BRINGUP_DONE or RCC_BRINGUP_FAILED, 0 for none
+
+  Output: status_t
+
+ */
+extern status_t RCC_startBringUp (uint32_t clock, rccBringUpCBF_t callbackFn);
+
+/*
+  Description: This function shall go on with clock bring up and count its timeout, it shall be
+               called every RCC_BRINGUP_POLL_PERIOD_US until bring up ends
+
+  Input:
+        1- state -> pointer to hold RCC_BRINGUP_x
+
+  Output: status_t
+
+ */
+extern status_t RCC_pollBringUp (uint32_t * state);
+
 #endif
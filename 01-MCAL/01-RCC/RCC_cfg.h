@@ -0,0 +1,63 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: MCAL                                  */
+/* Component: RCC                               */
+/* File Name: RCC_cfg.h                         */
+/************************************************/
+
+
+#ifndef RCC_CFG_H
+#define RCC_CFG_H
+
+/* Callbacks that can subscribe to clock changes, drivers depending on bus clocks register one each */
+#define RCC_MAX_CLOCK_CALLBACKS  4
+
+/* Checks of a ready flag RCC_setClockStatus makes before it gives up on a clock */
+#define RCC_READY_TIMEOUT_POLLS  50000
+
+/*
+  Period in micro seconds at which application calls RCC_pollBringUp during clock bring up, as from
+  a scheduler task, it is still needed when RCC interrupt drives the bring up since it counts the timeout
+*/
+#define RCC_BRINGUP_POLL_PERIOD_US  1000
+
+/* Time in micro seconds a clock is waited for before bring up falls back to HSI */
+#define RCC_BRINGUP_TIMEOUT_US      100000
+
+/*
+  Clock profiles applied by RCC_applyProfile, one line per profile:
+    RCC_PROFILE(name, clock, pllSource, hseDivider, pllMul, ahbScaler, apb1Scaler, apb2Scaler, adcScaler, usbScaler, flashLatency, prefetch)
+  1- name       -> profile name, its identifier is RCC_PROFILE_ID_name
+  2- clock      -> SYSTEM_CLOCK_HSI, SYSTEM_CLOCK_HSE or SYSTEM_CLOCK_PLL
+  3- pllSource  -> PLL_SRC_HSI (HSI/2) or PLL_SRC_HSE
+  4- hseDivider -> PLLXTPRE_HSE_CLK_NOT_DIVIDED or PLLXTPRE_HSE_CLK_DIVIDED
+  5- pllMul     -> PLL_MUL_x
+  6- ahbScaler, apb1Scaler, apb2Scaler, adcScaler -> SCALER_x_y, APB1 shall not be faster than 36 MHz
+                 and ADC not faster than 14 MHz
+  7- usbScaler  -> SCALER_USB_PLL_DIVIDED or SCALER_USB_PLL_NOT_DIVIDED, USB needs 48 MHz
+  8- flashLatency -> FLASH_LATENCY_x for the system clock of the profile
+  9- prefetch   -> FLASH_PREFETCH_ENABLE or FLASH_PREFETCH_DISABLE
+  CFGR and CR values of every profile are built at compile time
+*/
+#define RCC_PROFILES_LIST \
+		RCC_PROFILE(HSI_8MHZ, SYSTEM_CLOCK_HSI, PLL_SRC_HSI, PLLXTPRE_HSE_CLK_NOT_DIVIDED, PLL_MUL_2, \
+				SCALER_AHB_1, SCALER_APB1_1, SCALER_APB2_1, SCALER_ADC_2, SCALER_USB_PLL_DIVIDED, FLASH_LATENCY_0, FLASH_PREFETCH_ENABLE) \
+		RCC_PROFILE(PLL_36MHZ, SYSTEM_CLOCK_PLL, PLL_SRC_HSI, PLLXTPRE_HSE_CLK_NOT_DIVIDED, PLL_MUL_9, \
+				SCALER_AHB_1, SCALER_APB1_1, SCALER_APB2_1, SCALER_ADC_4, SCALER_USB_PLL_DIVIDED, FLASH_LATENCY_1, FLASH_PREFETCH_ENABLE) \
+		RCC_PROFILE(PLL_72MHZ, SYSTEM_CLOCK_PLL, PLL_SRC_HSE, PLLXTPRE_HSE_CLK_NOT_DIVIDED, PLL_MUL_9, \
+				SCALER_AHB_1, SCALER_APB1_2, SCALER_APB2_1, SCALER_ADC_6, SCALER_USB_PLL_DIVIDED, FLASH_LATENCY_2, FLASH_PREFETCH_ENABLE)
+
+/* Profile identifiers in list order, RCC_PROFILE_ID_name */
+#define RCC_PROFILE(name, clock, pllSource, hseDivider, pllMul, ahbScaler, apb1Scaler, apb2Scaler, adcScaler, usbScaler, flashLatency, prefetch) \
+	RCC_PROFILE_ID_##name,
+typedef enum
+{
+	RCC_PROFILES_LIST
+	RCC_PROFILES_NUMBER
+}rccProfileId_t;
+#undef RCC_PROFILE
+
+
+#endif
@@ -46,13 +46,13 @@
 #define PIN15   0x00008000
 #define PIN_All 0x0000FFFF
 
-#define PORTA (void *) 0x40010800 
-#define PORTB (void *) 0x40010C00
-#define PORTC (void *) 0x40011000
-#define PORTD (void *) 0x40011400
-#define PORTE (void *) 0x40011800
-#define PORTF (void *) 0x40011C00
-#define PORTG (void *) 0x40012000
+#define PORTA REG_BLOCK(0x40010800) 
+#define PORTB REG_BLOCK(0x40010C00)
+#define PORTC REG_BLOCK(0x40011000)
+#define PORTD REG_BLOCK(0x40011400)
+#define PORTE REG_BLOCK(0x40011800)
+#define PORTF REG_BLOCK(0x40011C00)
+#define PORTG REG_BLOCK(0x40012000)
 
 
 /*
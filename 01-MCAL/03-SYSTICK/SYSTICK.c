@@ -19,7 +19,9 @@
 
 #define SYSTICK_CLOCK_PRESCALER		8
 
-#define SYSTICK_BASE_ADDRESS   ((volatile void*)0xE000E010)
+#define SYSTICK_MAX_LOAD          0x00FFFFFF
+
+#define SYSTICK_BASE_ADDRESS   REG_BLOCK(0xE000E010)
 
 
 typedef struct
@@ -31,10 +33,16 @@ typedef struct
 
 } SYSTICK_t;
 
-SYSTICK_t * SYSTICK = (SYSTICK_t *) SYSTICK_BASE_ADDRESS;
+volatile SYSTICK_t * const  SYSTICK = (SYSTICK_t *) SYSTICK_BASE_ADDRESS;
 
 systickCBF_t ApplicationCBF;
 
+/* This function shall return the divider between AHB clock and counter clock selected in CTRL */
+static uint32_t SYSTICK_getDivider (void)
+{
+	return (SYSTICK->CTRL & CLKSOURCE_AHB) ? 1 : SYSTICK_CLOCK_PRESCALER;
+}
+
 /*
   Description: This function shall initiate systick by setting prescaler and enabling timer interrupt
 
@@ -46,8 +54,8 @@ systickCBF_t ApplicationCBF;
 status_t SYSTICK_init (void)
 {
 	status_t status = status_Ok;
-	/* Set timer prescaler */
-#if SYSTICK_TIMER_PRESCALER == CLOCK_PRE_AHB_NO_DIV
+	/* Set timer prescaler, automatic selection starts without division */
+#if SYSTICK_TIMER_PRESCALER == CLOCK_PRE_AHB_NO_DIV || SYSTICK_TIMER_PRESCALER == CLOCK_PRE_AUTO
 	SYSTICK->CTRL |= CLKSOURCE_AHB;
 #elif SYSTICK_TIMER_PRESCALER == CLOCK_PRE_AHB_WITH_DIV
 	SYSTICK->CTRL &= ~CLKSOURCE_AHB;
@@ -60,7 +68,8 @@ status_t SYSTICK_init (void)
 }
 
 /*
-  Description: This function shall start timer
+  Description: This function shall start timer, it returns once counter is loaded from LOAD,
+               so a LOAD written after it applies from the next period
 
   Input: void
 
@@ -77,6 +86,12 @@ status_t SYSTICK_start (void)
 	/* Start Timer */
 	SYSTICK->CTRL |= COUNTER_ENABLE;
 
+	/* Waiting for the first reload, so LOAD written after start is for the next period only */
+	if (SYSTICK->LOAD != 0)
+	{
+		REG_WAIT_WHILE(SYSTICK->VAL == 0);
+	}
+
 	return status;
 }
 
@@ -98,8 +113,32 @@ status_t SYSTICK_stop (void)
 	return status;
 }
 
+/* This function shall load counts of time at the given divider, status_Nok if they do not fit LOAD */
+static status_t SYSTICK_loadTime (uint32_t timeUs, uint32_t AHB_clockMHz, uint32_t divider)
+{
+	status_t status = status_Ok;
+	uint64_t counts;
+
+	counts = ((uint64_t)timeUs * AHB_clockMHz) / divider;
+
+	/* Counter counts from LOAD down to zero, so a period is LOAD + 1 counts */
+	if (counts == 0 || counts > SYSTICK_MAX_LOAD + 1ULL)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		/* Load required value */
+		SYSTICK->LOAD = (uint32_t)(counts - 1);
+	}
+
+	return status;
+}
+
 /*
-  Description: This function shall set time for timer
+  Description: This function shall set time for timer, status_Nok if it does not fit the 24 bits
+               LOAD register, with CLOCK_PRE_AUTO the prescaler is selected for the time while
+               timer is stopped, a running timer keeps its prescaler
 
   Input:
         1- timeUs -> the value of time represented in micro seconds
@@ -110,23 +149,65 @@ status_t SYSTICK_stop (void)
  */
 status_t SYSTICK_setTimeUs (uint32_t timeUs, uint32_t AHB_clockMHz)
 {
-	uint32_t status = status_Ok;
+	status_t status;
+	uint32_t divider;
 
-	uint32_t frequency;
-	uint32_t load;
 #if SYSTICK_TIMER_PRESCALER == CLOCK_PRE_AHB_NO_DIV
-	frequency = AHB_clockMHz;
+	divider = 1;
 #elif SYSTICK_TIMER_PRESCALER == CLOCK_PRE_AHB_WITH_DIV
-	frequency = AHB_clockMHz / SYSTICK_CLOCK_PRESCALER;
+	divider = SYSTICK_CLOCK_PRESCALER;
+#elif SYSTICK_TIMER_PRESCALER == CLOCK_PRE_AUTO
+	/* Counter clock is not switched under a running count, it would stretch or shrink its rest */
+	if (SYSTICK->CTRL & COUNTER_ENABLE)
+	{
+		divider = SYSTICK_getDivider();
+	}
+	/* AHB clock keeps the finest resolution, it is divided only if the period does not fit LOAD */
+	else if ((uint64_t)timeUs * AHB_clockMHz > SYSTICK_MAX_LOAD + 1ULL)
+	{
+		divider = SYSTICK_CLOCK_PRESCALER;
+	}
+	else
+	{
+		divider = 1;
+	}
 #endif
-	load = timeUs * frequency;
 
-	/* Load required value */
-	SYSTICK->LOAD = load;
+	status = SYSTICK_loadTime(timeUs, AHB_clockMHz, divider);
+
+#if SYSTICK_TIMER_PRESCALER == CLOCK_PRE_AUTO
+	if (status == status_Ok && !(SYSTICK->CTRL & COUNTER_ENABLE))
+	{
+		if (divider == 1)
+		{
+			SYSTICK->CTRL |= CLKSOURCE_AHB;
+		}
+		else
+		{
+			SYSTICK->CTRL &= ~CLKSOURCE_AHB;
+		}
+	}
+#endif
 
 	return status;
 }
 
+/*
+  Description: This function shall set time for timer with the prescaler already selected, so a
+               part of a period set by SYSTICK_setTimeUs is counted at the same resolution
+
+  Input:
+        1- timeUs -> the value of time represented in micro seconds
+        2- AHB_clockMHz -> represents the system clock in mega hertz
+
+  Output: status_t
+
+ */
+status_t SYSTICK_setPartialTimeUs (uint32_t timeUs, uint32_t AHB_clockMHz)
+{
+	return SYSTICK_loadTime(timeUs, AHB_clockMHz, SYSTICK_getDivider());
+}
+
 /*
   Description: This function shall set callback function on interrupt occurance
 
@@ -153,6 +234,70 @@ status_t SYSTICK_setCallback (systickCBF_t callbackFn)
 	return status;
 }
 
+/*
+  Description: This function shall get time elapsed since the counter was last reloaded
+
+  Input:
+        1- elapsedUs -> pointer to hold the elapsed time in micro seconds
+        2- AHB_clockMHz -> represents the system clock in mega hertz
+
+  Output: status_t
+
+ */
+status_t SYSTICK_getElapsedUs (uint32_t * elapsedUs, uint32_t AHB_clockMHz)
+{
+	status_t status = status_Ok;
+
+	uint32_t value;
+
+	value = SYSTICK->VAL;
+
+	/* Counter is cleared by start and not yet reloaded */
+	if (value == 0 || AHB_clockMHz == 0)
+	{
+		*elapsedUs = 0;
+	}
+	else
+	{
+		*elapsedUs = ((SYSTICK->LOAD - value) * SYSTICK_getDivider()) / AHB_clockMHz;
+	}
+
+	return status;
+}
+
+/*
+  Description: This function shall get the longest time the 24 bits LOAD register can hold
+
+  Input:
+        1- maxTimeUs -> pointer to hold the maximum time in micro seconds
+        2- AHB_clockMHz -> represents the system clock in mega hertz
+
+  Output: status_t
+
+ */
+status_t SYSTICK_getMaxTimeUs (uint32_t * maxTimeUs, uint32_t AHB_clockMHz)
+{
+	status_t status = status_Ok;
+
+	uint32_t divider;
+#if SYSTICK_TIMER_PRESCALER == CLOCK_PRE_AHB_NO_DIV
+	divider = 1;
+#else
+	divider = SYSTICK_CLOCK_PRESCALER;
+#endif
+
+	if (AHB_clockMHz == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*maxTimeUs = ((SYSTICK_MAX_LOAD + 1ULL) * divider) / AHB_clockMHz;
+	}
+
+	return status;
+}
+
 /* SYSTICK exception handler */
 void SysTick_Handler (void)
 {
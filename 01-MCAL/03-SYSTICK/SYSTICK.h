@@ -15,6 +15,7 @@
 
 #define CLOCK_PRE_AHB_NO_DIV    1
 #define CLOCK_PRE_AHB_WITH_DIV  2
+#define CLOCK_PRE_AUTO          3
 
 
 typedef void (*systickCBF_t)(void);
@@ -31,7 +32,8 @@ typedef void (*systickCBF_t)(void);
 extern status_t SYSTICK_init (void);
 
 /* 
-  Description: This function shall start timer 
+  Description: This function shall start timer, it returns once counter is loaded from LOAD,
+               so a LOAD written after it applies from the next period
   
   Input: void
   
@@ -51,7 +53,9 @@ extern status_t SYSTICK_start (void);
 extern status_t SYSTICK_stop (void);
 
 /* 
-  Description: This function shall set time for timer 
+  Description: This function shall set time for timer, status_Nok if it does not fit the 24 bits
+               LOAD register, with CLOCK_PRE_AUTO the prescaler is selected for the time while
+               timer is stopped, a running timer keeps its prescaler
   
   Input: 
         1- timeUs -> the value of time represented in micro seconds
@@ -62,6 +66,19 @@ extern status_t SYSTICK_stop (void);
  */
 extern status_t SYSTICK_setTimeUs (uint32_t timeUs, uint32_t AHB_clockMHz);
 
+/* 
+  Description: This function shall set time for timer with the prescaler already selected, so a
+               part of a period set by SYSTICK_setTimeUs is counted at the same resolution
+  
+  Input: 
+        1- timeUs -> the value of time represented in micro seconds
+        2- AHB_clockMHz -> represents the system clock in mega hertz
+        
+  Output: status_t
+
+ */
+extern status_t SYSTICK_setPartialTimeUs (uint32_t timeUs, uint32_t AHB_clockMHz);
+
 /* 
   Description: This function shall set callback function on interrupt occurance
   
@@ -73,4 +90,28 @@ extern status_t SYSTICK_setTimeUs (uint32_t timeUs, uint32_t AHB_clockMHz);
  */
 extern status_t SYSTICK_setCallback (systickCBF_t callbackFn);
 
+/* 
+  Description: This function shall get time elapsed since the counter was last reloaded
+  
+  Input: 
+        1- elapsedUs -> pointer to hold the elapsed time in micro seconds
+        2- AHB_clockMHz -> represents the system clock in mega hertz
+        
+  Output: status_t
+
+ */
+extern status_t SYSTICK_getElapsedUs (uint32_t * elapsedUs, uint32_t AHB_clockMHz);
+
+/* 
+  Description: This function shall get the longest time the 24 bits LOAD register can hold
+  
+  Input: 
+        1- maxTimeUs -> pointer to hold the maximum time in micro seconds
+        2- AHB_clockMHz -> represents the system clock in mega hertz
+        
+  Output: status_t
+
+ */
+extern status_t SYSTICK_getMaxTimeUs (uint32_t * maxTimeUs, uint32_t AHB_clockMHz);
+
 #endif
@@ -16,8 +16,9 @@
   Options are:
   1- CLOCK_PRE_AHB_NO_DIV
   2- CLOCK_PRE_AHB_WITH_DIV
+  3- CLOCK_PRE_AUTO -> AHB clock, divided by 8 only for times that do not fit LOAD without division
 */
-#define SYSTICK_TIMER_PRESCALER  CLOCK_PRE_AHB_NO_DIV
+#define SYSTICK_TIMER_PRESCALER  CLOCK_PRE_AUTO
 
 
 #endif
\ No newline at end of file
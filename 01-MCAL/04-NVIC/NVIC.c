@@ -11,13 +11,17 @@
 
 #include "NVIC.h"
 
-#define NVIC_BASE_ADDRESS ((volatile void*) 0xE000E100)
+#define NVIC_BASE_ADDRESS REG_BLOCK(0xE000E100)
 
-#define NVIC_STIR *((volatile uint32_t*)0xE000EF00)
+#define NVIC_STIR *((volatile uint32_t*)REG_BLOCK(0xE000EF00))
 
-#define SCB_AIRCR *((volatile uint32_t*)0xE000ED0C) 
+#define SCB_AIRCR *((volatile uint32_t*)REG_BLOCK(0xE000ED0C))
 
-#define SCB_CCR *((volatile uint32_t*)0xE000ED14)
+#define SCB_CCR *((volatile uint32_t*)REG_BLOCK(0xE000ED14))
+
+#define SCB_ICSR *((volatile uint32_t*)REG_BLOCK(0xE000ED04))
+
+#define SCB_SHPR ((volatile uint8_t*)REG_BLOCK(0xE000ED18))
 
 #define VECTKEY       0x05FA0000
 #define VECTKEY_CLR   0xFFFF0000
@@ -25,6 +29,9 @@
 
 #define USERSETMPEND 0x00000002 
 
+#define PENDSVSET    0x10000000
+#define PENDSTSET    0x04000000
+
 typedef struct
 {
 	uint32_t SETENA [8];
@@ -328,6 +335,85 @@ status_t NVIC_generateSoftwareInterrupt(uint32_t interrupt)
 	return status;
 }
 
+/* 
+  Description: This function shall set priority for system handlers
+
+  Input:  handler -> represents system handler to set its priority, options are SYS_HANDLER_x
+          priority -> represents the value of priority
+
+  Output: status_t
+
+ */
+status_t NVIC_setSystemPriority(uint32_t handler, uint8_t priority)
+{
+	status_t status = status_Ok;
+
+	/* SHPR1..SHPR3 hold priorities of system handlers 4 to 15 */
+	if (handler < SYS_HANDLER_MEM_MANAGE || handler > SYS_HANDLER_SYSTICK)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		/* Setting system handler priority */
+		SCB_SHPR[handler - SYS_HANDLER_MEM_MANAGE] = priority;
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall set pending flag of PendSV system handler
+
+  Input:  void
+
+  Output: status_t
+
+ */
+status_t NVIC_setPendSV(void)
+{
+	status_t status = status_Ok;
+
+	/* Writing zeros to ICSR has no effect, so no read modify write is needed */
+	SCB_ICSR = PENDSVSET;
+
+	return status;
+}
+
+/* 
+  Description: This function shall get pending flag of a system handler, it is set from the
+               event until the handler is entered, even while interrupts are held
+
+  Input:  handler -> represents system handler, options are SYS_HANDLER_PENDSV or SYS_HANDLER_SYSTICK
+          pending -> pointer to hold 1 if handler is pending, 0 otherwise
+
+  Output: status_t
+
+ */
+status_t NVIC_getSystemPending(uint32_t handler, uint8_t * pending)
+{
+	status_t status = status_Ok;
+
+	if (pending == 0)
+	{
+		status = status_Nok;
+	}
+	else if (handler == SYS_HANDLER_PENDSV)
+	{
+		*pending = (SCB_ICSR & PENDSVSET) ? 1 : 0;
+	}
+	else if (handler == SYS_HANDLER_SYSTICK)
+	{
+		*pending = (SCB_ICSR & PENDSTSET) ? 1 : 0;
+	}
+	else
+	{
+		status = status_Nok;
+	}
+
+	return status;
+}
+
 /* 
   Description: This function shall enable PRIMASK
 
@@ -341,8 +427,7 @@ status_t NVIC_enablePRIMASK(void)
 	status_t status = status_Ok;
 
 	/* Disable all interrupts */
-	asm ("MOV R0, #1");
-	asm("MSR PRIMASK, R0");
+	CORE_SET_PRIMASK(1);
 
 	return status;
 }
@@ -360,8 +445,7 @@ status_t NVIC_disablePRIMASK(void)
 	status_t status = status_Ok;
 
 	/* Allow all interrupts */
-	asm ("MOV R0, #0");
-	asm("MSR PRIMASK, R0");
+	CORE_SET_PRIMASK(0);
 
 	return status;
 }
@@ -379,8 +463,7 @@ status_t NVIC_enableFAULTMASK(void)
 	status_t status = status_Ok;
 
 	/* Disable all interrupts and hard fault handlers*/
-	asm ("MOV R0, #1");
-	asm("MSR FAULTMASK, R0");
+	CORE_SET_FAULTMASK(1);
 
 	return status;
 }
@@ -398,8 +481,7 @@ status_t NVIC_disableFAULTMASK(void)
 	status_t status = status_Ok;
 
 	/* Allow all interrupts*/
-	asm ("MOV R0, #0");
-	asm("MSR FAULTMASK, R0");
+	CORE_SET_FAULTMASK(0);
 
 	return status;
 }
@@ -418,8 +500,7 @@ status_t NVIC_enableFilterBasedPriority(uint32_t levelValue)
 	status_t status = status_Ok;
 
 	/* Disable all interrupts with priority equal to or lower than levelValue*/
-	asm ("MOV R0, %0" : : "r" (levelValue));
-	asm("MSR BASEPRI, R0");
+	CORE_SET_BASEPRI(levelValue);
 
 
 	return status;
@@ -438,8 +519,7 @@ status_t NVIC_disableFilterBasedPriority(void)
 	status_t status = status_Ok;
 
 	/* Disable filter based priority */
-	asm ("MOV R0, #0x0");
-	asm("MSR BASEPRI, R0");
+	CORE_SET_BASEPRI(0);
 
 
 	return status;
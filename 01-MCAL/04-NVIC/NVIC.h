@@ -72,6 +72,15 @@
 #define INT_DMA2_Channel4_5     59
 
 
+#define SYS_HANDLER_MEM_MANAGE  4
+#define SYS_HANDLER_BUS_FAULT   5
+#define SYS_HANDLER_USAGE_FAULT 6
+#define SYS_HANDLER_SVCALL      11
+#define SYS_HANDLER_DEBUG_MON   12
+#define SYS_HANDLER_PENDSV      14
+#define SYS_HANDLER_SYSTICK     15
+
+
 #define PRI_GRP16_SUB0  0x00000300
 #define PRI_GRP8_SUB2   0x00000400
 #define PRI_GRP4_SUB4   0x00000500
@@ -187,6 +196,39 @@ extern status_t NVIC_setGroupBits(uint32_t groupPriority);
  */
 extern status_t NVIC_generateSoftwareInterrupt(uint32_t interrupt);
 
+/* 
+  Description: This function shall set priority for system handlers
+  
+  Input:  handler -> represents system handler to set its priority, options are SYS_HANDLER_x
+          priority -> represents the value of priority
+  
+  Output: status_t
+
+ */
+extern status_t NVIC_setSystemPriority(uint32_t handler, uint8_t priority);
+
+/* 
+  Description: This function shall set pending flag of PendSV system handler
+  
+  Input:  void
+  
+  Output: status_t
+
+ */
+extern status_t NVIC_setPendSV(void);
+
+/* 
+  Description: This function shall get pending flag of a system handler, it is set from the
+               event until the handler is entered, even while interrupts are held
+  
+  Input:  handler -> represents system handler, options are SYS_HANDLER_PENDSV or SYS_HANDLER_SYSTICK
+          pending -> pointer to hold 1 if handler is pending, 0 otherwise
+  
+  Output: status_t
+
+ */
+extern status_t NVIC_getSystemPending(uint32_t handler, uint8_t * pending);
+
 /* 
   Description: This function shall enable PRIMASK
   
@@ -0,0 +1,109 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: MCAL                                  */
+/* Component: IWDG                              */
+/* File Name: IWDG.c                            */
+/************************************************/
+
+#include "STD_TYPES.h"
+
+#include "IWDG.h"
+
+
+/* Key register values */
+#define KEY_RELOAD  ((uint32_t)0xAAAA)
+#define KEY_ACCESS  ((uint32_t)0x5555)
+#define KEY_START   ((uint32_t)0xCCCC)
+
+/* Status register masks, prescaler and reload values are being updated in LSI domain */
+#define IWDG_SR_PVU  0x00000001
+#define IWDG_SR_RVU  0x00000002
+
+#define LSI_KHZ          40
+#define MAX_RELOAD       0x0FFF
+/* Prescaler register value 0 divides LSI by 4, every step doubles it up to 256 */
+#define MIN_DIVIDER      4
+#define MAX_PRESCALER    6
+
+/* IWDG base address on APB1 bus */
+#define IWDG_BASE_ADDRESS REG_BLOCK(0x40003000)
+
+/* IWDG registers */
+typedef struct
+{
+	uint32_t KR;
+	uint32_t PR;
+	uint32_t RLR;
+	uint32_t SR;
+
+} IWDG_t;
+
+
+volatile IWDG_t * const  IWDG = (IWDG_t *) IWDG_BASE_ADDRESS;
+
+
+/*
+  Description: This function shall start independent watchdog, once started it can only be
+               stopped by a reset. LSI is turned on by hardware
+
+  Input:
+		1- timeoutMs -> time without refresh before reset in milli seconds, from 1 to IWDG_MAX_TIMEOUT_MS
+
+  Output: status_t
+
+*/
+status_t IWDG_start (uint32_t timeoutMs)
+{
+	status_t status = status_Ok;
+	uint32_t prescaler = 0;
+	uint32_t counts;
+
+	if (timeoutMs == 0 || timeoutMs > IWDG_MAX_TIMEOUT_MS)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		/* Smallest divider that holds timeout gives the finest resolution */
+		counts = (timeoutMs * LSI_KHZ) / MIN_DIVIDER;
+		while (counts > MAX_RELOAD + 1 && prescaler < MAX_PRESCALER)
+		{
+			prescaler++;
+			counts = (timeoutMs * LSI_KHZ) / (MIN_DIVIDER << prescaler);
+		}
+		if (counts == 0)
+		{
+			counts = 1;
+		}
+
+		IWDG->KR = KEY_START;
+
+		/* Prescaler and reload registers are write protected */
+		IWDG->KR = KEY_ACCESS;
+		REG_WAIT_WHILE(IWDG->SR & IWDG_SR_PVU);
+		IWDG->PR = prescaler;
+		REG_WAIT_WHILE(IWDG->SR & IWDG_SR_RVU);
+		IWDG->RLR = counts - 1;
+
+		/* Counter starts from the new reload value */
+		REG_WAIT_WHILE(IWDG->SR & (IWDG_SR_PVU | IWDG_SR_RVU));
+		IWDG->KR = KEY_RELOAD;
+	}
+
+	return status;
+}
+
+/*
+  Description: This function shall reload watchdog counter
+
+  Input:  void
+
+  Output: void
+
+*/
+void IWDG_refresh (void)
+{
+	IWDG->KR = KEY_RELOAD;
+}
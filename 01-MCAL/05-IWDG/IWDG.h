@@ -0,0 +1,41 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: MCAL                                  */
+/* Component: IWDG                              */
+/* File Name: IWDG.h                            */
+/************************************************/
+
+
+#ifndef IWDG_H
+#define IWDG_H
+
+/* Longest timeout, counter of 4096 at LSI / 256 */
+#define IWDG_MAX_TIMEOUT_MS  26214
+
+/*
+  Description: This function shall start independent watchdog, once started it can only be
+               stopped by a reset. LSI is turned on by hardware
+
+  Input:
+		1- timeoutMs -> time without refresh before reset in milli seconds, from 1 to IWDG_MAX_TIMEOUT_MS,
+		                based on LSI nominal 40 KHz (30 to 60 KHz over parts and temperature)
+
+  Output: status_t
+
+*/
+extern status_t IWDG_start (uint32_t timeoutMs);
+
+/*
+  Description: This function shall reload watchdog counter
+
+  Input:  void
+
+  Output: void
+
+*/
+extern void IWDG_refresh (void);
+
+
+#endif
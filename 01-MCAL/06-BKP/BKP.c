@@ -0,0 +1,117 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: MCAL                                  */
+/* Component: BKP                               */
+/* File Name: BKP.c                             */
+/************************************************/
+
+#include "STD_TYPES.h"
+
+#include "RCC.h"
+
+#include "BKP.h"
+
+
+/* Disable backup domain write protection bit of PWR control register */
+#define PWR_CR_DBP  0x00000100
+
+/* PWR and BKP base addresses on APB1 bus */
+#define PWR_BASE_ADDRESS REG_BLOCK(0x40007000)
+#define BKP_BASE_ADDRESS REG_BLOCK(0x40006C00)
+
+/* PWR registers */
+typedef struct
+{
+	uint32_t CR;
+	uint32_t CSR;
+
+} PWR_t;
+
+/* BKP registers, only the low half word of every data register is implemented */
+typedef struct
+{
+	uint32_t Reserved;
+	uint32_t DR[BKP_DATA_REGISTERS];
+	uint32_t RTCCR;
+	uint32_t CR;
+	uint32_t CSR;
+
+} BKP_t;
+
+
+volatile PWR_t * const  PWR = (PWR_t *) PWR_BASE_ADDRESS;
+volatile BKP_t * const  BKP = (BKP_t *) BKP_BASE_ADDRESS;
+
+
+/*
+  Description: This function shall enable backup domain clocks and write access to it
+
+  Input:  void
+
+  Output: status_t
+
+*/
+status_t BKP_init (void)
+{
+	status_t status;
+
+	status = RCC_setAPB1_PeripheralState(APB1ENR_PWR | APB1ENR_BKP, STATE_ENABLE);
+
+	PWR->CR |= PWR_CR_DBP;
+
+	return status;
+}
+
+/*
+  Description: This function shall write a backup data register
+
+  Input:
+		1- dataRegister -> 1 to BKP_DATA_REGISTERS
+		2- value -> value to be kept
+
+  Output: status_t
+
+*/
+status_t BKP_write (uint32_t dataRegister, uint16_t value)
+{
+	status_t status = status_Ok;
+
+	if (dataRegister == 0 || dataRegister > BKP_DATA_REGISTERS)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		BKP->DR[dataRegister - 1] = value;
+	}
+
+	return status;
+}
+
+/*
+  Description: This function shall read a backup data register
+
+  Input:
+		1- dataRegister -> 1 to BKP_DATA_REGISTERS
+		2- value -> pointer to hold register value
+
+  Output: status_t
+
+*/
+status_t BKP_read (uint32_t dataRegister, uint16_t * value)
+{
+	status_t status = status_Ok;
+
+	if (dataRegister == 0 || dataRegister > BKP_DATA_REGISTERS || value == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*value = (uint16_t)BKP->DR[dataRegister - 1];
+	}
+
+	return status;
+}
@@ -0,0 +1,53 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: MCAL                                  */
+/* Component: BKP                               */
+/* File Name: BKP.h                             */
+/************************************************/
+
+
+#ifndef BKP_H
+#define BKP_H
+
+/* Data registers of medium density parts, 16 bits each, kept across system resets */
+#define BKP_DATA_REGISTERS  10
+
+/*
+  Description: This function shall enable backup domain clocks and write access to it,
+               RCC driver is used to enable PWR and BKP clocks
+
+  Input:  void
+
+  Output: status_t
+
+*/
+extern status_t BKP_init (void);
+
+/*
+  Description: This function shall write a backup data register
+
+  Input:
+		1- dataRegister -> 1 to BKP_DATA_REGISTERS
+		2- value -> value to be kept
+
+  Output: status_t
+
+*/
+extern status_t BKP_write (uint32_t dataRegister, uint16_t value);
+
+/*
+  Description: This function shall read a backup data register
+
+  Input:
+		1- dataRegister -> 1 to BKP_DATA_REGISTERS
+		2- value -> pointer to hold register value
+
+  Output: status_t
+
+*/
+extern status_t BKP_read (uint32_t dataRegister, uint16_t * value);
+
+
+#endif
@@ -11,6 +11,8 @@
 
 #include "FLASH.h"
 
+#include "RCC.h"
+
 
 /* Unlocking FPEC block keys*/
 #define KEY1  ((uint32_t)0x45670123)
@@ -35,8 +37,21 @@
 #define FLASH_CR_ERRIE  				0x00000400
 #define FLASH_CR_EOPIE  				0x00001000
 
+/* Flash access control register masks */
+#define FLASH_ACR_LATENCY				0x00000007
+#define FLASH_ACR_HLFCYA				0x00000008
+#define FLASH_ACR_PRFTBE				0x00000010
+#define FLASH_ACR_PRFTBS				0x00000020
+
+/* Highest system clock of every wait state count */
+#define FLASH_LATENCY_0_MAX_FREQ		24000000
+#define FLASH_LATENCY_1_MAX_FREQ		48000000
+
+/* Half cycle access is allowed up to this AHB clock */
+#define FLASH_HALF_CYCLE_MAX_FREQ		8000000
+
 /* Flash base address on AHB bus */
-#define FLASH_BASE_ADDRESS ((volatile void*) 0x40022000)
+#define FLASH_BASE_ADDRESS REG_BLOCK(0x40022000)
 
 /* FLASH registers */
 typedef struct 
@@ -110,13 +125,13 @@ status_t FLASH_programPage (uint32_t  desiredAddress, uint16_t desiredValue)
 	else
 	{
 		/* Checking that there is no flash memory operation is ongoing*/
-		while ((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
+		REG_WAIT_WHILE((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
 
 		/* Choose flash programming */
 		FLASH->CR |= FLASH_CR_PG;
 
 		/* Programming half word */
-		*((uint16_t *)desiredAddress) = desiredValue;
+		*((volatile uint16_t *)MEM_ADDRESS(desiredAddress)) = desiredValue;
 
 		/* Checking if address was erased before or not */
 		programmingErr = FLASH->SR & FLASH_SR_PGERR;
@@ -127,10 +142,10 @@ status_t FLASH_programPage (uint32_t  desiredAddress, uint16_t desiredValue)
 		else
 		{
 			/* Waiting on busy flag */
-			while ((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
+			REG_WAIT_WHILE((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
 
 			/* Checking the programmed value */
-			programmedValue = *((uint16_t *)desiredAddress);
+			programmedValue = *((volatile uint16_t *)MEM_ADDRESS(desiredAddress));
 
 			if (programmedValue != desiredValue)
 			{
@@ -145,6 +160,166 @@ status_t FLASH_programPage (uint32_t  desiredAddress, uint16_t desiredValue)
 	return status;
 }
 
+/* This function shall program one half word while programming is chosen, flash is ready on return */
+static status_t FLASH_streamHalfWord (uint32_t desiredAddress, uint16_t desiredValue)
+{
+	status_t status = status_Ok;
+
+	*((volatile uint16_t *)MEM_ADDRESS(desiredAddress)) = desiredValue;
+
+	/* Waiting on busy flag */
+	REG_WAIT_WHILE((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
+
+	/* Checking if address was erased and not write protected */
+	if (FLASH->SR & (FLASH_SR_PGERR | FLASH_SR_WRPRTERR))
+	{
+		status = status_Nok;
+	}
+
+	return status;
+}
+
+/* This function shall clear flags of the last flash operation, they are cleared by writing 1 */
+static void FLASH_clearStatus (void)
+{
+	FLASH->SR = FLASH_SR_PGERR | FLASH_SR_WRPRTERR | FLASH_SR_EOP;
+}
+
+/* This function shall check buffer and that flash is unlocked and idle then choose programming */
+static status_t FLASH_startProgramming (uint32_t desiredAddress, const void * buffer)
+{
+	status_t status = status_Ok;
+
+	if (buffer == 0 || (desiredAddress & 1) || (FLASH->CR & FLASH_CR_LOCK) == FLASH_CR_LOCK)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		REG_WAIT_WHILE((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
+
+		/* Flags left by an earlier failure would fail this programming */
+		FLASH_clearStatus();
+
+		FLASH->CR |= FLASH_CR_PG;
+	}
+
+	return status;
+}
+
+/*
+  Description: This function shall program consecutive half words in FLASH, programming is
+               chosen once for the whole buffer and it is verified in one pass at the end
+
+  Input:  
+		1- desiredAddress -> Desired half word aligned address to program
+		2- buffer -> Half words to be programmed
+		3- halfWordsNumber -> Number of half words in buffer
+
+  Output: status_t 
+
+ */
+status_t FLASH_programBuffer (uint32_t  desiredAddress, const uint16_t * buffer, uint32_t halfWordsNumber)
+{
+	status_t status;
+	uint32_t local_xLoop;
+
+	status = FLASH_startProgramming(desiredAddress, buffer);
+	if (status == status_Ok)
+	{
+		for (local_xLoop = 0; local_xLoop < halfWordsNumber && status == status_Ok; local_xLoop++)
+		{
+			status = FLASH_streamHalfWord(desiredAddress + local_xLoop * 2, buffer[local_xLoop]);
+		}
+
+		/* Stopping flash programming, error flags are not left for the next one */
+		FLASH->CR &= ~FLASH_CR_PG;
+		if (status != status_Ok)
+		{
+			FLASH_clearStatus();
+		}
+
+		/* Checking the programmed values */
+		for (local_xLoop = 0; local_xLoop < halfWordsNumber && status == status_Ok; local_xLoop++)
+		{
+			if (*((volatile uint16_t *)MEM_ADDRESS(desiredAddress + local_xLoop * 2)) != buffer[local_xLoop])
+			{
+				status = status_Nok;
+			}
+		}
+	}
+
+	return status;
+}
+
+/*
+  Description: This function shall program word in FLASH as two half words, lower one first
+
+  Input:  
+		1- desiredAddress -> Desired half word aligned address to program
+		2- desiredValue -> Desired value to be programmed
+
+  Output: status_t 
+
+ */
+status_t FLASH_programWord (uint32_t  desiredAddress, uint32_t desiredValue)
+{
+	return FLASH_programWordBuffer(desiredAddress, &desiredValue, 1);
+}
+
+/*
+  Description: This function shall program consecutive words in FLASH, programming is
+               chosen once for the whole buffer and it is verified in one pass at the end
+
+  Input:  
+		1- desiredAddress -> Desired half word aligned address to program
+		2- buffer -> Words to be programmed
+		3- wordsNumber -> Number of words in buffer
+
+  Output: status_t 
+
+ */
+status_t FLASH_programWordBuffer (uint32_t  desiredAddress, const uint32_t * buffer, uint32_t wordsNumber)
+{
+	status_t status;
+	uint32_t local_xLoop;
+	uint32_t address;
+
+	status = FLASH_startProgramming(desiredAddress, buffer);
+	if (status == status_Ok)
+	{
+		for (local_xLoop = 0; local_xLoop < wordsNumber && status == status_Ok; local_xLoop++)
+		{
+			address = desiredAddress + local_xLoop * 4;
+			status = FLASH_streamHalfWord(address, (uint16_t)buffer[local_xLoop]);
+			if (status == status_Ok)
+			{
+				status = FLASH_streamHalfWord(address + 2, (uint16_t)(buffer[local_xLoop] >> 16));
+			}
+		}
+
+		/* Stopping flash programming, error flags are not left for the next one */
+		FLASH->CR &= ~FLASH_CR_PG;
+		if (status != status_Ok)
+		{
+			FLASH_clearStatus();
+		}
+
+		/* Checking the programmed values */
+		for (local_xLoop = 0; local_xLoop < wordsNumber && status == status_Ok; local_xLoop++)
+		{
+			address = desiredAddress + local_xLoop * 4;
+			if (*((volatile uint16_t *)MEM_ADDRESS(address)) != (uint16_t)buffer[local_xLoop] ||
+					*((volatile uint16_t *)MEM_ADDRESS(address + 2)) != (uint16_t)(buffer[local_xLoop] >> 16))
+			{
+				status = status_Nok;
+			}
+		}
+	}
+
+	return status;
+}
+
 /* 
   Description: This function shall erase sector in FLASH
 
@@ -168,7 +343,7 @@ status_t FLASH_erasePage (uint32_t  desiredAddress)
 	else
 	{
 		/* Checking that there is no flash memory operation is ongoing*/
-		while ((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
+		REG_WAIT_WHILE((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
 
 		/* Choose flash erasing */
 		FLASH->CR |= FLASH_CR_PER;
@@ -180,7 +355,7 @@ status_t FLASH_erasePage (uint32_t  desiredAddress)
 		FLASH->CR |= FLASH_CR_STRT;
 
 		/* Waiting on busy flag */
-		while ((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
+		REG_WAIT_WHILE((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
 
 
 		/* Stopping flash erasing */
@@ -211,7 +386,7 @@ status_t FLASH_massErase(void)
 	else
 	{
 		/* Checking that there is no flash memory operation is ongoing*/
-		while ((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
+		REG_WAIT_WHILE((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
 
 		/* Choose flash mass erasing */
 		FLASH->CR |= FLASH_CR_MER;
@@ -220,7 +395,7 @@ status_t FLASH_massErase(void)
 		FLASH->CR |= FLASH_CR_STRT;
 
 		/* Waiting on busy flag */
-		while ((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
+		REG_WAIT_WHILE((FLASH->SR & FLASH_SR_BSY) == FLASH_SR_BSY);
 
 		/* Stopping flash erasing */
 		FLASH->CR &= ~FLASH_CR_MER;
@@ -228,4 +403,212 @@ status_t FLASH_massErase(void)
 	return status;
 }
 
+/* 
+  Description: This function shall set wait states of flash access, they shall be raised before
+               system clock gets faster and lowered after it gets slower
+
+  Input:  
+		1- latency -> FLASH_LATENCY_x
+
+  Output: status_t 
+
+ */
+status_t FLASH_setLatency (uint32_t latency)
+{
+	status_t status = status_Ok;
+
+	if (latency == FLASH_LATENCY_0 || latency == FLASH_LATENCY_1 || latency == FLASH_LATENCY_2)
+	{
+		FLASH->ACR = (FLASH->ACR & ~FLASH_ACR_LATENCY) | latency;
+		/* New wait states apply once they read back */
+		REG_WAIT_WHILE((FLASH->ACR & FLASH_ACR_LATENCY) != latency);
+	}
+	else
+	{
+		status = status_Nok;
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall get wait states of flash access
+
+  Input:  
+		1- latency -> pointer to hold FLASH_LATENCY_x
+
+  Output: status_t 
+
+ */
+status_t FLASH_getLatency (uint32_t * latency)
+{
+	status_t status = status_Ok;
+
+	*latency = FLASH->ACR & FLASH_ACR_LATENCY;
+
+	return status;
+}
+
+/* 
+  Description: This function shall get the least wait states of flash access for a system clock
+
+  Input:  
+		1- sysclkFreq -> system clock in Hz
+		2- latency -> pointer to hold FLASH_LATENCY_x
+
+  Output: status_t 
+
+ */
+status_t FLASH_getLatencyForClock (uint32_t sysclkFreq, uint32_t * latency)
+{
+	status_t status = status_Ok;
+
+	if (sysclkFreq <= FLASH_LATENCY_0_MAX_FREQ)
+	{
+		*latency = FLASH_LATENCY_0;
+	}
+	else if (sysclkFreq <= FLASH_LATENCY_1_MAX_FREQ)
+	{
+		*latency = FLASH_LATENCY_1;
+	}
+	else
+	{
+		*latency = FLASH_LATENCY_2;
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall enable or disable prefetch buffer, it shall be switched only
+               while system clock is below 24 MHz and AHB is not divided
+
+  Input:  
+		1- state -> FLASH_PREFETCH_ENABLE or FLASH_PREFETCH_DISABLE
+
+  Output: status_t 
+
+ */
+status_t FLASH_setPrefetch (uint32_t state)
+{
+	status_t status = status_Ok;
+
+	if (state == FLASH_PREFETCH_ENABLE)
+	{
+		FLASH->ACR |= FLASH_ACR_PRFTBE;
+		/* Buffer status follows the enable bit */
+		REG_WAIT_WHILE(!(FLASH->ACR & FLASH_ACR_PRFTBS));
+	}
+	else if (state == FLASH_PREFETCH_DISABLE)
+	{
+		FLASH->ACR &= ~FLASH_ACR_PRFTBE;
+		REG_WAIT_WHILE(FLASH->ACR & FLASH_ACR_PRFTBS);
+	}
+	else
+	{
+		status = status_Nok;
+	}
+
+	return status;
+}
+
+/* This function shall tell if half cycle access is allowed at the given clocks, HSI or HSE undivided up to 8 MHz */
+static uint8_t FLASH_isHalfCycleAllowed (const rccClocks_t * clocks)
+{
+	return (clocks->sysclkSource != SYSTEM_CLOCK_PLL && clocks->ahbFreq == clocks->sysclkFreq &&
+			clocks->ahbFreq <= FLASH_HALF_CYCLE_MAX_FREQ);
+}
+
+/* 
+  Description: This function shall enable or disable half cycle flash access, it is enabled only
+               while system clock is HSI or HSE up to 8 MHz and AHB is not divided
+
+  Input:  
+		1- state -> FLASH_HALF_CYCLE_ENABLE or FLASH_HALF_CYCLE_DISABLE
+
+  Output: status_t 
+
+ */
+status_t FLASH_setHalfCycle (uint32_t state)
+{
+	status_t status = status_Ok;
+	rccClocks_t clocks;
+
+	RCC_getClocks(&clocks);
+
+	if (state == FLASH_HALF_CYCLE_ENABLE && FLASH_isHalfCycleAllowed(&clocks))
+	{
+		FLASH->ACR |= FLASH_ACR_HLFCYA;
+	}
+	else if (state == FLASH_HALF_CYCLE_DISABLE)
+	{
+		FLASH->ACR &= ~FLASH_ACR_HLFCYA;
+	}
+	else
+	{
+		status = status_Nok;
+	}
+
+	return status;
+}
+
+/* This function shall fit flash access to system clock around its changes */
+static void FLASH_clockChanged (uint32_t event, const rccClocks_t * clocks)
+{
+	uint32_t latency;
+	uint32_t current = FLASH->ACR & FLASH_ACR_LATENCY;
+
+	FLASH_getLatencyForClock(clocks->sysclkFreq, &latency);
 
+	if (event == RCC_CLOCK_PRE_CHANGE)
+	{
+		/* Flash is slowed before clock gets faster */
+		if (latency > current)
+		{
+			FLASH_setLatency(latency);
+		}
+		if (!FLASH_isHalfCycleAllowed(clocks))
+		{
+			FLASH->ACR &= ~FLASH_ACR_HLFCYA;
+		}
+	}
+	else
+	{
+		/* Flash is relaxed once the slower clock runs */
+		if (latency < current)
+		{
+			FLASH_setLatency(latency);
+		}
+		if (FLASH_isHalfCycleAllowed(clocks))
+		{
+			FLASH->ACR |= FLASH_ACR_HLFCYA;
+		}
+	}
+}
+
+/* 
+  Description: This function shall keep flash access fitted to system clock from now on. Wait states
+               are set to the minimum for the current clock, raised before every clock change that
+               needs more and lowered after every change that needs less. Half cycle access is used
+               while HSI or HSE runs up to 8 MHz with AHB not divided. Prefetch buffer is left as set
+
+  Input:  void
+
+  Output: status_t 
+
+ */
+status_t FLASH_trackSystemClock (void)
+{
+	status_t status;
+	rccClocks_t clocks;
+
+	RCC_getClocks(&clocks);
+
+	/* Current clock is applied as a finished change */
+	FLASH_clockChanged(RCC_CLOCK_PRE_CHANGE, &clocks);
+	FLASH_clockChanged(RCC_CLOCK_POST_CHANGE, &clocks);
+
+	status = RCC_registerClockCallback(FLASH_clockChanged);
+
+	return status;
+}
@@ -11,6 +11,17 @@
 #ifndef FLASH_H
 #define FLASH_H
 
+/* Wait states of flash access, 0 up to 24 MHz, 1 up to 48 MHz and 2 up to 72 MHz of system clock */
+#define FLASH_LATENCY_0  0
+#define FLASH_LATENCY_1  1
+#define FLASH_LATENCY_2  2
+
+#define FLASH_PREFETCH_ENABLE   1
+#define FLASH_PREFETCH_DISABLE  2
+
+#define FLASH_HALF_CYCLE_ENABLE   1
+#define FLASH_HALF_CYCLE_DISABLE  2
+
 /*
   Description: This function shall lock FPEC block
 
@@ -43,6 +54,46 @@ extern void FLASH_unlock (void);
 */
 extern status_t FLASH_programPage (uint32_t  desiredAddress, uint16_t desiredValue);
 
+/*
+  Description: This function shall program consecutive half words in FLASH, programming is
+               chosen once for the whole buffer and it is verified in one pass at the end
+
+  Input:  
+		1- desiredAddress -> Desired half word aligned address to program
+		2- buffer -> Half words to be programmed
+		3- halfWordsNumber -> Number of half words in buffer
+
+  Output: status_t 
+
+*/
+extern status_t FLASH_programBuffer (uint32_t  desiredAddress, const uint16_t * buffer, uint32_t halfWordsNumber);
+
+/*
+  Description: This function shall program word in FLASH as two half words, lower one first
+
+  Input:  
+		1- desiredAddress -> Desired half word aligned address to program
+		2- desiredValue -> Desired value to be programmed
+
+  Output: status_t 
+
+*/
+extern status_t FLASH_programWord (uint32_t  desiredAddress, uint32_t desiredValue);
+
+/*
+  Description: This function shall program consecutive words in FLASH, programming is
+               chosen once for the whole buffer and it is verified in one pass at the end
+
+  Input:  
+		1- desiredAddress -> Desired half word aligned address to program
+		2- buffer -> Words to be programmed
+		3- wordsNumber -> Number of words in buffer
+
+  Output: status_t 
+
+*/
+extern status_t FLASH_programWordBuffer (uint32_t  desiredAddress, const uint32_t * buffer, uint32_t wordsNumber);
+
 /* 
   Description: This function shall erase sector in FLASH
 
@@ -64,5 +115,77 @@ extern status_t FLASH_erasePage (uint32_t  desiredAddress);
 */
 extern status_t FLASH_massErase(void);
 
+/* 
+  Description: This function shall set wait states of flash access, they shall be raised before
+               system clock gets faster and lowered after it gets slower
+
+  Input:  
+		1- latency -> FLASH_LATENCY_x
+
+  Output: status_t 
+
+*/
+extern status_t FLASH_setLatency (uint32_t latency);
+
+/* 
+  Description: This function shall get wait states of flash access
+
+  Input:  
+		1- latency -> pointer to hold FLASH_LATENCY_x
+
+  Output: status_t 
+
+*/
+extern status_t FLASH_getLatency (uint32_t * latency);
+
+/* 
+  Description: This function shall get the least wait states of flash access for a system clock
+
+  Input:  
+		1- sysclkFreq -> system clock in Hz
+		2- latency -> pointer to hold FLASH_LATENCY_x
+
+  Output: status_t 
+
+*/
+extern status_t FLASH_getLatencyForClock (uint32_t sysclkFreq, uint32_t * latency);
+
+/* 
+  Description: This function shall enable or disable prefetch buffer, it shall be switched only
+               while system clock is below 24 MHz and AHB is not divided
+
+  Input:  
+		1- state -> FLASH_PREFETCH_ENABLE or FLASH_PREFETCH_DISABLE
+
+  Output: status_t 
+
+*/
+extern status_t FLASH_setPrefetch (uint32_t state);
+
+/* 
+  Description: This function shall enable or disable half cycle flash access, it is enabled only
+               while system clock is HSI or HSE up to 8 MHz and AHB is not divided
+
+  Input:  
+		1- state -> FLASH_HALF_CYCLE_ENABLE or FLASH_HALF_CYCLE_DISABLE
+
+  Output: status_t 
+
+*/
+extern status_t FLASH_setHalfCycle (uint32_t state);
+
+/* 
+  Description: This function shall keep flash access fitted to system clock from now on. Wait states
+               are set to the minimum for the current clock, raised before every clock change that
+               needs more and lowered after every change that needs less. Half cycle access is used
+               while HSI or HSE runs up to 8 MHz with AHB not divided. Prefetch buffer is left as set
+
+  Input:  void
+
+  Output: status_t 
+
+*/
+extern status_t FLASH_trackSystemClock (void);
+
 
 #endif
@@ -72,4 +72,15 @@ extern status_t SwitchTask_GetSwitchState(uint32_t switchNum, uint8_t * switchVa
  */
 extern void switchTask (void);
 
+/* 
+  Description: This function shall return an element of switch from switchMap array
+
+  Input: 
+        1- switchNum -> holds the index of the switch in the switch array 
+
+  Output: Address of switch struct that maps the switchNum 
+
+ */
+extern switchmap_t * getSwitchMap (uint32_t switchNum);
+
 #endif
@@ -0,0 +1,98 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: LIB                                   */
+/* Component: REG_BACKEND                       */
+/* File Name: REG_BACKEND.h                     */
+/************************************************/
+
+/*
+  Register backend used by all drivers to reach peripheral blocks.
+  On target every macro resolves to the real memory mapped address or core instruction,
+  when HOST_SIM is defined they resolve to the simulated register file in 05-HOST/01-SIM
+*/
+
+#ifndef REG_BACKEND_H
+#define REG_BACKEND_H
+
+#ifndef HOST_SIM
+
+/* Peripheral register block at the given bus address */
+#define REG_BLOCK(address)        ((void *)(address))
+
+/* Memory (FLASH/SRAM) location at the given bus address */
+#define MEM_ADDRESS(address)      ((void *)(address))
+
+/* Busy wait on a hardware status bit */
+#define REG_WAIT_WHILE(condition) while (condition)
+
+/* Core special registers */
+#define CORE_SET_PRIMASK(value)   asm volatile ("MSR PRIMASK, %0" : : "r" (value) : "memory")
+#define CORE_SET_FAULTMASK(value) asm volatile ("MSR FAULTMASK, %0" : : "r" (value) : "memory")
+#define CORE_SET_BASEPRI(value)   asm volatile ("MSR BASEPRI, %0" : : "r" (value) : "memory")
+
+/* Number of the exception being handled, 0 in thread mode */
+#define CORE_GET_IPSR()           ({ uint32_t ipsr; asm volatile ("MRS %0, IPSR" : "=r" (ipsr)); ipsr; })
+
+/* PRIMASK of the caller, saved by a critical section that may be entered with interrupts held */
+#define CORE_GET_PRIMASK()        ({ uint32_t primask; asm volatile ("MRS %0, PRIMASK" : "=r" (primask)); primask; })
+
+/* Sleep until next interrupt, a pending interrupt wakes the core even if PRIMASK is set */
+#define CORE_WFI()                asm volatile ("WFI" : : : "memory")
+
+/* Memory accesses before the barrier complete before the ones after it */
+#define CORE_DMB()                asm volatile ("DMB" : : : "memory")
+
+/* Condition of a main loop, firmware never leaves it */
+#define CORE_KEEP_RUNNING()       1
+
+#else
+
+#define SIM_PERIPH_BASE   0x40000000UL
+#define SIM_PERIPH_SIZE   0x00023400UL
+#define SIM_CORE_BASE     0xE000E000UL
+#define SIM_CORE_SIZE     0x00001000UL
+
+extern uint32_t SIM_peripheralRegion[SIM_PERIPH_SIZE / 4];
+extern uint32_t SIM_coreRegion[SIM_CORE_SIZE / 4];
+
+extern void * SIM_mapAddress (uint32_t address);
+extern void SIM_spin (void);
+extern void SIM_setCoreRegister (uint32_t coreRegister, uint32_t value);
+extern uint32_t SIM_getCoreRegister (uint32_t coreRegister);
+extern void SIM_waitForInterrupt (void);
+extern uint32_t SIM_keepRunning (void);
+
+#define SIM_PRIMASK    0
+#define SIM_FAULTMASK  1
+#define SIM_BASEPRI    2
+#define SIM_IPSR       3
+
+/* Address constant so it can still be used in static initializers */
+#define REG_BLOCK(address) \
+	((void *)(((address) >= SIM_CORE_BASE) ? \
+			&SIM_coreRegion[((address) - SIM_CORE_BASE) / 4] : \
+			&SIM_peripheralRegion[((address) - SIM_PERIPH_BASE) / 4]))
+
+#define MEM_ADDRESS(address)      SIM_mapAddress(address)
+
+/* The hardware model is stepped at least once so it can react to the request just written */
+#define REG_WAIT_WHILE(condition) do { SIM_spin(); } while (condition)
+
+#define CORE_SET_PRIMASK(value)   SIM_setCoreRegister(SIM_PRIMASK, value)
+#define CORE_SET_FAULTMASK(value) SIM_setCoreRegister(SIM_FAULTMASK, value)
+#define CORE_SET_BASEPRI(value)   SIM_setCoreRegister(SIM_BASEPRI, value)
+#define CORE_GET_IPSR()           SIM_getCoreRegister(SIM_IPSR)
+#define CORE_GET_PRIMASK()        SIM_getCoreRegister(SIM_PRIMASK)
+
+#define CORE_WFI()                SIM_waitForInterrupt()
+
+#define CORE_DMB()                __sync_synchronize()
+
+/* Main loop returns once the run SIM_runFor allowed is over */
+#define CORE_KEEP_RUNNING()       SIM_keepRunning()
+
+#endif
+
+#endif
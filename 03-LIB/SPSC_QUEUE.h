@@ -0,0 +1,227 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: LIB                                   */
+/* Component: SPSC_QUEUE                        */
+/* File Name: SPSC_QUEUE.h                      */
+/************************************************/
+
+/*
+  Lock-free single producer single consumer ring buffer of fixed size elements.
+  One context (an ISR or a task) only enqueues and one other context only dequeues,
+  then no interrupt needs to be disabled: producer is the only writer of head and
+  consumer the only writer of tail. Indices run freely and are masked on access, so all
+  slots are used and count is head - tail even after indices wrap.
+  Capacity shall be a power of 2, buffer holds capacity * elementSize bytes.
+*/
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+typedef struct
+{
+	uint8_t * buffer;
+	uint32_t elementSize;
+	uint32_t mask;
+	/* Next slot to write, written by producer only */
+	volatile uint32_t head;
+	/* Next slot to read, written by consumer only */
+	volatile uint32_t tail;
+
+}spscQueue_t;
+
+
+/* This function shall copy size bytes between queue slots and caller memory */
+static inline void SPSC_copy (uint8_t * destination, const uint8_t * source, uint32_t size)
+{
+	while (size--)
+	{
+		*destination++ = *source++;
+	}
+}
+
+/*
+  Description: This function shall initiate an empty queue, it shall be called before
+               producer and consumer use it
+
+  Input:
+		1- queue -> queue to initiate
+		2- buffer -> memory of capacity * elementSize bytes
+		3- elementSize -> size of one element in bytes
+		4- capacity -> number of elements, a power of 2
+
+  Output: status_t
+
+*/
+static inline status_t SPSC_init (spscQueue_t * queue, void * buffer, uint32_t elementSize, uint32_t capacity)
+{
+	status_t status = status_Ok;
+
+	if (queue == 0 || buffer == 0 || elementSize == 0 || capacity == 0 || (capacity & (capacity - 1)) != 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		queue->buffer = (uint8_t *)buffer;
+		queue->elementSize = elementSize;
+		queue->mask = capacity - 1;
+		queue->head = 0;
+		queue->tail = 0;
+	}
+
+	return status;
+}
+
+/*
+  Description: This function shall enqueue up to count elements, from producer context only
+
+  Input:
+		1- queue -> queue
+		2- elements -> count consecutive elements
+		3- count -> number of elements to enqueue
+		4- written -> pointer to hold number of elements enqueued, less than count when queue gets full
+
+  Output: status_t, status_Nok if no element was enqueued
+
+*/
+static inline status_t SPSC_enqueueBatch (spscQueue_t * queue, const void * elements, uint32_t count, uint32_t * written)
+{
+	uint32_t head = queue->head;
+	uint32_t space = (queue->mask + 1) - (head - queue->tail);
+	uint32_t slot = head & queue->mask;
+	uint32_t first;
+
+	if (count > space)
+	{
+		count = space;
+	}
+
+	/* At most two copies, up to the end of buffer then from its start */
+	first = (queue->mask + 1) - slot;
+	if (first > count)
+	{
+		first = count;
+	}
+	SPSC_copy(&queue->buffer[slot * queue->elementSize], (const uint8_t *)elements, first * queue->elementSize);
+	SPSC_copy(queue->buffer, (const uint8_t *)elements + first * queue->elementSize, (count - first) * queue->elementSize);
+
+	/* Elements are in memory before consumer can see the new head */
+	CORE_DMB();
+	queue->head = head + count;
+
+	if (written)
+	{
+		*written = count;
+	}
+
+	return count ? status_Ok : status_Nok;
+}
+
+/*
+  Description: This function shall dequeue up to count elements, from consumer context only
+
+  Input:
+		1- queue -> queue
+		2- elements -> memory for count consecutive elements
+		3- count -> number of elements to dequeue
+		4- read -> pointer to hold number of elements dequeued, less than count when queue gets empty
+
+  Output: status_t, status_Nok if no element was dequeued
+
+*/
+static inline status_t SPSC_dequeueBatch (spscQueue_t * queue, void * elements, uint32_t count, uint32_t * read)
+{
+	uint32_t tail = queue->tail;
+	uint32_t used = queue->head - tail;
+	uint32_t slot = tail & queue->mask;
+	uint32_t first;
+
+	if (count > used)
+	{
+		count = used;
+	}
+
+	/* Elements written before head are visible once head is */
+	CORE_DMB();
+
+	first = (queue->mask + 1) - slot;
+	if (first > count)
+	{
+		first = count;
+	}
+	SPSC_copy((uint8_t *)elements, &queue->buffer[slot * queue->elementSize], first * queue->elementSize);
+	SPSC_copy((uint8_t *)elements + first * queue->elementSize, queue->buffer, (count - first) * queue->elementSize);
+
+	/* Slots are read before producer can reuse them */
+	CORE_DMB();
+	queue->tail = tail + count;
+
+	if (read)
+	{
+		*read = count;
+	}
+
+	return count ? status_Ok : status_Nok;
+}
+
+/*
+  Description: This function shall enqueue one element, from producer context only
+
+  Input:
+		1- queue -> queue
+		2- element -> element to enqueue
+
+  Output: status_t, status_Nok if queue is full
+
+*/
+static inline status_t SPSC_enqueue (spscQueue_t * queue, const void * element)
+{
+	return SPSC_enqueueBatch(queue, element, 1, 0);
+}
+
+/*
+  Description: This function shall dequeue one element, from consumer context only
+
+  Input:
+		1- queue -> queue
+		2- element -> memory for dequeued element
+
+  Output: status_t, status_Nok if queue is empty
+
+*/
+static inline status_t SPSC_dequeue (spscQueue_t * queue, void * element)
+{
+	return SPSC_dequeueBatch(queue, element, 1, 0);
+}
+
+/*
+  Description: This function shall get number of elements in queue, other context may change it
+               meanwhile, consumer can only make it shrink and producer can only make it grow
+
+  Input:
+		1- queue -> queue
+		2- count -> pointer to hold number of elements
+
+  Output: status_t
+
+*/
+static inline status_t SPSC_getCount (const spscQueue_t * queue, uint32_t * count)
+{
+	status_t status = status_Ok;
+
+	if (count == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*count = queue->head - queue->tail;
+	}
+
+	return status;
+}
+
+
+#endif
@@ -13,11 +13,20 @@
 
 #define uint8_t  unsigned char
 #define uint16_t unsigned short int
+#ifndef HOST_SIM
 #define uint32_t unsigned long int 
+#else
+/* long is 64 bits on the host, registers must stay 32 bits wide */
+#define uint32_t unsigned int
+#endif
+#define uint64_t unsigned long long int
 
 #define status_t uint32_t
 #define status_Ok  1
 #define status_Nok 2
+/* Operation can not be done now without blocking, caller shall try again later */
+#define status_Pending 3
 
+#include "REG_BACKEND.h"
 
 #endif
\ No newline at end of file
@@ -12,117 +12,2484 @@
 
 #include "RCC.h"
 #include "SYSTICK.h"
+#include "NVIC.h"
+#include "IWDG.h"
+#include "BKP.h"
 
 #include "SCHEDULER.h"
 #include "SCHEDULER_cfg.h"
 
-typedef struct 
+/* Tick count reached the given tick, stays right when counter wraps */
+#define TICK_REACHED(tick) ((uint32_t)(tickCount - (tick)) < 0x80000000UL)
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+/* Ticks a run may take before its task is stuck, rounded up */
+#define HANG_TICKS         ((SCHED_HANG_TIMEOUT_USEC + TICK_USEC - 1) / TICK_USEC)
+
+/* High byte of backup register marks a saved stuck task, low byte is its index */
+#define RESET_MARKER       0xA500
+#define RESET_MARKER_MASK  0xFF00
+
+/* Value of resetTask when last reset was not caused by supervision */
+#define NO_RESET_TASK      (SCHED_TASKS_POOL_SIZE + 1)
+
+_Static_assert(SCHED_WATCHDOG_TIMEOUT_MS * 1000ULL > TICK_USEC,
+		"SCHED_WATCHDOG_TIMEOUT_MS shall be longer than a tick");
+_Static_assert(SCHED_WATCHDOG_TIMEOUT_MS <= IWDG_MAX_TIMEOUT_MS, "SCHED_WATCHDOG_TIMEOUT_MS is out of watchdog range");
+_Static_assert(SCHED_TASKS_POOL_SIZE < 0xFF, "stuck task index shall fit in low byte of backup register");
+#endif
+
+#if SCHED_IDLE_MODE != SCHED_IDLE_BUSY_WAIT
+/* Ticks of CPU load window, one second rounded up to whole ticks */
+#define LOAD_WINDOW_TICKS      ((1000000 + TICK_USEC - 1) / TICK_USEC)
+
+/* CPU load before the first window completes */
+#define LOAD_NOT_MEASURED      0xFFFFFFFF
+#endif
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+#if SCHED_IDLE_MODE == SCHED_IDLE_TICKLESS
+#error "SCHED_IDLE_TICKLESS is supported with SCHED_MODE_COOPERATIVE only"
+#endif
+
+/* Lower than any task priority */
+#define IDLE_TASK_PRIORITY     0x100
+/* Lowest priority so PendSV never preempts SysTick or application interrupts */
+#define PENDSV_PRIORITY        0xFF
+
+/* Words of ready bitmap, one bit per pool slot */
+#define READY_WORDS            ((SCHED_TASKS_POOL_SIZE + 31) / 32)
+
+/* Initial exception frame (R0-R3, R12, LR, PC, xPSR) and R4-R11 saved by PendSV */
+#define CONTEXT_WORDS          16
+#define CONTEXT_PC             14
+#define CONTEXT_XPSR           15
+#define INITIAL_XPSR           0x01000000
+#endif
+
+/* Pool slot states */
+#define TASK_STATE_FREE        0
+#define TASK_STATE_ACTIVE      1
+#define TASK_STATE_SUSPENDED   2
+
+/* Offset of a task not placed yet while offsets are computed */
+#define OFFSET_NOT_PLACED      0xFFFFFFFF
+
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+#define STATS_WORDS_NUMBER     (SCHED_STATS_DUMP_RECORD_SIZE / 4)
+#endif
+
+/*
+  Tasks are kept in a delta queue ordered by due tick, remainTicksToExec of each
+  element is relative to the element before it, so a tick only touches the queue
+  head and the tasks that are actually due, a suspended task is out of the queue.
+  Tasks of the pool at index i < MAX_TASKS_NUMBER are described by sysTasksInfo[i] in flash,
+  the rest are created at run time and described by dynamicTasksInfo in RAM
+*/
+typedef struct sysTask
+{
+	uint32_t remainTicksToExec;
+	struct sysTask * next;
+	/* Copied from the table so it can be changed at run time */
+	uint32_t periodTicks;
+	uint8_t state;
+	/* Task is linked in the delta queue or in the list of due tasks being processed */
+	uint8_t queued;
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	/* Set by SCHED_activateTask, cleared when event task is dispatched */
+	volatile uint8_t activated;
+#endif
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+	uint32_t * stackPointer;
+	uint32_t priority;
+	/* Set by a release, cleared when the run serving it starts */
+	volatile uint8_t ready;
+	/* Set while task waits in a delay, it is not picked until tick count reaches wakeTick */
+	volatile uint8_t waiting;
+	uint32_t wakeTick;
+	/* Next task in the queue of waiting tasks */
+	struct sysTask * nextWaiting;
+#endif
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+	taskStats_t stats;
+	uint32_t releaseUs;
+	uint32_t execSumUs;
+	uint32_t execSumRuns;
+#endif
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	/* Tick by which current release shall complete and tick its run started at */
+	uint32_t deadlineTick;
+	uint32_t startTick;
+	uint32_t deadlineMisses;
+	/* Set from start to end of a run, a preempted run is still running */
+	volatile uint8_t running;
+	/* Current release was already counted as missed */
+	uint8_t missed;
+#endif
+
+}sysTask_t;
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+/* Ticks raised by SysTick and not yet processed by scheduler */
+static volatile uint32_t pendingTicks;
+
+/* Set after activated flag of an event task so scheduler scans event tasks only when needed */
+static volatile uint8_t eventsPending;
+#endif
+
+static uint32_t tickOverruns;
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+/* Set once a stuck run is found, watchdog is no longer refreshed */
+static volatile uint8_t supervisorTripped;
+
+/* Stuck task saved before the last reset, NO_RESET_TASK if reset was not caused by supervision */
+static uint32_t resetTask;
+#endif
+
+static uint32_t worstTickLoadUs;
+
+static sysTask_t sysTasks[SCHED_TASKS_POOL_SIZE];
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE && SCHED_MODE == SCHED_MODE_COOPERATIVE
+/* Task whose runnable is being called from scheduler */
+static sysTask_t * volatile runningTask;
+#endif
+
+static const sysTasksInfo_t * sysTasksInfo;
+
+#if SCHED_DYNAMIC_TASKS_NUMBER > 0
+static sysTasksInfo_t dynamicTasksInfo[SCHED_DYNAMIC_TASKS_NUMBER];
+#endif
+
+/* Description of a system task */
+#define TASK_INFO(task)  SCHED_getTaskInfo(task)
+
+static sysTask_t * readyQueue;
+
+static uint32_t systemClockMHz;
+
+#if SCHED_IDLE_MODE != SCHED_IDLE_BUSY_WAIT
+/* Time core slept in current CPU load window */
+static volatile uint32_t idleUs;
+
+/* Ticks passed in current CPU load window */
+static uint32_t loadWindowTicks;
+
+/* CPU load of the last complete window, LOAD_NOT_MEASURED before the first one */
+static uint32_t cpuLoadPermille;
+#endif
+
+#if SCHED_IDLE_MODE != SCHED_IDLE_BUSY_WAIT
+/* Set while core sleeps in idle, from SysTick time within the tick when sleep started */
+static volatile uint8_t sleeping;
+static volatile uint32_t sleepStartUs;
+#endif
+
+#if SCHED_IDLE_MODE == SCHED_IDLE_TICKLESS
+static uint32_t maxIdleTicks;
+#endif
+
+/* Ticks since scheduler start, with SysTick counter it is the time base, high word counts wraps of low word */
+static volatile uint32_t tickCount;
+static volatile uint32_t tickCountHigh;
+
+/* Ticks processed by scheduler, tasks due within them are released at their tick boundary */
+static uint32_t processedTicks;
+
+/* Set once SysTick is started, time base does not move before */
+static uint8_t timeBaseRunning;
+
+/* Periods SysTick counted for delays before scheduler start */
+static volatile uint32_t startWraps;
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+static sysTask_t idleTask;
+
+static sysTask_t * currentTask;
+
+/* Tasks with a pending release or a started run that do not wait in a delay, bit i is pool slot i */
+static uint32_t readyTasks[READY_WORDS];
+
+/* Tasks waiting in a delay ordered by wake tick, a tick only touches the ones that wake */
+static sysTask_t * waitQueue;
+
+/* Tasks' stacks, the last one is for idle task */
+static uint32_t taskStacks[SCHED_TASKS_POOL_SIZE + 1][SCHED_STACK_SIZE_WORDS] __attribute__((aligned(8)));
+
+uint32_t * SCHED_switchContext (uint32_t * stackPointer);
+#endif
+
+/* This function shall count ticks of time base. Interrupts shall be held by caller */
+static void SCHED_countTicks (uint32_t ticks)
+{
+	uint32_t previous = tickCount;
+
+	tickCount = previous + ticks;
+	if (tickCount < previous)
+	{
+		tickCountHigh++;
+	}
+}
+
+/* 
+  Description: This function shall restart SysTick counter with the rest of the current tick,
+               next reloads are one tick long. Prescaler is selected for a whole tick and the
+               rest is counted with it, so LOAD - VAL is still the time passed since the tick
+               boundary once LOAD holds one tick. Counter shall be stopped and interrupts held
+               by caller
+
+  Input:
+        1- tickElapsedUs -> time passed of the current tick
+
+  Output: status_t
+
+ */
+static status_t SCHED_restartTick (uint32_t tickElapsedUs)
+{
+	status_t status = status_Ok;
+
+	/* A counter can not be restarted with an empty period */
+	if (tickElapsedUs >= TICK_USEC)
+	{
+		tickElapsedUs = TICK_USEC - 1;
+	}
+
+	if (SYSTICK_setTimeUs(TICK_USEC, systemClockMHz) != status_Ok ||
+			SYSTICK_setPartialTimeUs(TICK_USEC - tickElapsedUs, systemClockMHz) != status_Ok)
+	{
+		status = status_Nok;
+	}
+	SYSTICK_start();
+	if (SYSTICK_setPartialTimeUs(TICK_USEC, systemClockMHz) != status_Ok)
+	{
+		status = status_Nok;
+	}
+
+	return status;
+}
+
+#if SCHED_IDLE_MODE != SCHED_IDLE_BUSY_WAIT
+/* This function shall return time passed since the last tick boundary */
+static uint32_t SCHED_getTickElapsedUs (void)
+{
+	uint32_t elapsedUs;
+
+	SYSTICK_getElapsedUs(&elapsedUs, systemClockMHz);
+
+	return elapsedUs;
+}
+
+/* 
+  Description: This function shall add time core slept to idle time, a tick ends sleep at tick
+               boundary, any other wake up source ends it now. Interrupts shall be held by caller
+
+  Input:
+        1- byTick -> 1 if called from tick interrupt
+
+  Output: void
+
+ */
+static void SCHED_endSleep (uint8_t byTick)
+{
+	uint32_t nowUs = TICK_USEC;
+
+	if (sleeping)
+	{
+		if (!byTick)
+		{
+			nowUs = SCHED_getTickElapsedUs();
+		}
+		if (nowUs > sleepStartUs)
+		{
+			idleUs += nowUs - sleepStartUs;
+		}
+		sleeping = 0;
+	}
+}
+#endif
+
+/* This function shall return description of a task, in flash for tasks of the table */
+static const sysTasksInfo_t * SCHED_getTaskInfo (const sysTask_t * task)
+{
+	uint32_t taskIndex = task - sysTasks;
+	const sysTasksInfo_t * info = &sysTasksInfo[taskIndex];
+
+#if SCHED_DYNAMIC_TASKS_NUMBER > 0
+	if (taskIndex >= MAX_TASKS_NUMBER)
+	{
+		info = &dynamicTasksInfo[taskIndex - MAX_TASKS_NUMBER];
+	}
+#endif
+
+	return info;
+}
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+/* This function shall set deadline of a release, a release coalesced with one not completed yet keeps the earlier deadline */
+static void SCHED_releaseRun (sysTask_t * task, uint32_t releaseTick)
+{
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	if (task->activated || task->running)
+#else
+	if (task->ready || task->running)
+#endif
+	{
+		return;
+	}
+
+	task->deadlineTick = releaseTick + TASK_INFO(task)->deadlineTicks;
+	task->missed = 0;
+}
+
+/* This function shall count a missed deadline once per release, interrupts shall be held by caller */
+static void SCHED_checkDeadline (sysTask_t * task)
+{
+	if (!task->missed && TASK_INFO(task)->deadlineTicks != 0 && TICK_REACHED(task->deadlineTick))
+	{
+		task->missed = 1;
+		task->deadlineMisses++;
+	}
+}
+
+/* This function shall mark start of a run */
+static void SCHED_startRun (sysTask_t * task)
+{
+	CORE_SET_PRIMASK(1);
+	task->startTick = tickCount;
+	task->running = 1;
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	runningTask = task;
+#endif
+	CORE_SET_PRIMASK(0);
+}
+
+/* This function shall mark end of a run, it is late if its deadline tick was reached */
+static void SCHED_endRun (sysTask_t * task)
+{
+	CORE_SET_PRIMASK(1);
+	SCHED_checkDeadline(task);
+	task->running = 0;
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	runningTask = 0;
+#endif
+	CORE_SET_PRIMASK(0);
+}
+
+/* 
+  Description: This function shall supervise running tasks every tick and refresh watchdog,
+               once a run or the scheduler is stuck its index is saved and refresh stops
+               so watchdog resets the system
+
+  Input: void
+
+  Output: void
+
+ */
+static void SCHED_supervise (void)
+{
+	uint32_t stuckTask = NO_RESET_TASK;
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+	uint32_t local_taskLoop;
+#endif
+
+	if (supervisorTripped)
+	{
+		return;
+	}
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	if (runningTask)
+	{
+		SCHED_checkDeadline(runningTask);
+		if (tickCount - runningTask->startTick >= HANG_TICKS)
+		{
+			stuckTask = runningTask - sysTasks;
+		}
+	}
+	else if (pendingTicks >= HANG_TICKS)
+	{
+		/* No task is running and ticks are not taken, scheduler loop itself is stuck */
+		stuckTask = SCHED_TASKS_POOL_SIZE;
+	}
+#else
+	for (local_taskLoop = 0; local_taskLoop < SCHED_TASKS_POOL_SIZE; local_taskLoop ++)
+	{
+		if (sysTasks[local_taskLoop].running)
+		{
+			SCHED_checkDeadline(&sysTasks[local_taskLoop]);
+			if (tickCount - sysTasks[local_taskLoop].startTick >= HANG_TICKS)
+			{
+				stuckTask = local_taskLoop;
+			}
+		}
+	}
+#endif
+
+	if (stuckTask != NO_RESET_TASK)
+	{
+		supervisorTripped = 1;
+		BKP_write(SCHED_RESET_BKP_REGISTER, RESET_MARKER | stuckTask);
+	}
+	else
+	{
+		IWDG_refresh();
+	}
+}
+#endif
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+/* This function shall be the callback function of the scheduler */
+static void SCHED_countTick (void)
+{
+	if (!timeBaseRunning)
+	{
+		startWraps++;
+		return;
+	}
+
+	SCHED_countTicks(1);
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	SCHED_supervise();
+#endif
+#if SCHED_IDLE_MODE != SCHED_IDLE_BUSY_WAIT
+	SCHED_endSleep(1);
+#endif
+	/* Counting ticks so none is lost if scheduler is still busy with an earlier one */
+	pendingTicks++;
+}
+#endif
+
+/* 
+  Description: This function shall insert task in the delta queue
+
+  Input:
+        1- task -> Address of system task to insert
+        2- ticks -> number of ticks from now until task is due
+
+  Output: void
+
+ */
+static void SCHED_insertTask (sysTask_t * task, uint32_t ticks)
+{
+	sysTask_t ** link = &readyQueue;
+
+	/* Walking queue and consuming deltas, tasks due at the same tick keep tasks' table order */
+	while (*link && ((*link)->remainTicksToExec < ticks || ((*link)->remainTicksToExec == ticks && *link < task)))
+	{
+		ticks -= (*link)->remainTicksToExec;
+		link = &(*link)->next;
+	}
+
+	task->remainTicksToExec = ticks;
+	task->next = *link;
+	task->queued = 1;
+
+	/* Next task becomes relative to the inserted one */
+	if (*link)
+	{
+		(*link)->remainTicksToExec -= ticks;
+	}
+	*link = task;
+}
+
+/* This function shall unlink task from the delta queue, a due task being processed is left to SCHED_processTicks */
+static void SCHED_removeTask (sysTask_t * task)
+{
+	sysTask_t ** link = &readyQueue;
+
+	while (*link && *link != task)
+	{
+		link = &(*link)->next;
+	}
+
+	if (*link)
+	{
+		/* Next task becomes relative to the one before the removed task */
+		if (task->next)
+		{
+			task->next->remainTicksToExec += task->remainTicksToExec;
+		}
+		*link = task->next;
+		task->queued = 0;
+	}
+}
+
+/* This function shall return the least common multiple of tasks' periods, limited to SCHED_MAX_HYPERPERIOD_TICKS */
+static uint32_t SCHED_getHyperperiod (void)
+{
+	uint32_t hyperperiod = 1;
+	uint32_t local_taskLoop;
+	uint32_t a;
+	uint32_t b;
+	uint32_t remainder;
+
+	for (local_taskLoop = 0; local_taskLoop < MAX_TASKS_NUMBER; local_taskLoop ++)
+	{
+		/* Event tasks have no period */
+		if (sysTasksInfo[local_taskLoop].periodTicks == 0)
+		{
+			continue;
+		}
+
+		/* Greatest common divisor of current hyperperiod and task period */
+		a = hyperperiod;
+		b = sysTasksInfo[local_taskLoop].periodTicks;
+		while (b)
+		{
+			remainder = a % b;
+			a = b;
+			b = remainder;
+		}
+
+		if (hyperperiod / a > SCHED_MAX_HYPERPERIOD_TICKS / sysTasksInfo[local_taskLoop].periodTicks)
+		{
+			hyperperiod = SCHED_MAX_HYPERPERIOD_TICKS;
+			break;
+		}
+		hyperperiod = (hyperperiod / a) * sysTasksInfo[local_taskLoop].periodTicks;
+	}
+
+	return hyperperiod;
+}
+
+/* This function shall return sum of execution times of placed tasks released at a tick of the hyperperiod */
+static uint32_t SCHED_getTickLoad (uint32_t tick, const uint32_t * offsets)
+{
+	uint32_t loadUs = 0;
+	uint32_t local_taskLoop;
+	uint32_t periodTicks;
+
+	for (local_taskLoop = 0; local_taskLoop < MAX_TASKS_NUMBER; local_taskLoop ++)
+	{
+		periodTicks = sysTasksInfo[local_taskLoop].periodTicks;
+
+		if (periodTicks != 0 && offsets[local_taskLoop] != OFFSET_NOT_PLACED &&
+				tick % periodTicks == offsets[local_taskLoop] % periodTicks)
+		{
+			/* A task of unknown execution time still counts */
+			loadUs += sysTasksInfo[local_taskLoop].execUs ? sysTasksInfo[local_taskLoop].execUs : 1;
+		}
+	}
+
+	return loadUs;
+}
+
+#if SCHED_OFFSETS_MODE == SCHED_OFFSETS_AUTO
+/* This function shall return the worst load of the ticks a task is released at with the given offset */
+static uint32_t SCHED_getReleasesLoad (uint32_t periodTicks, uint32_t offset, uint32_t hyperperiod, const uint32_t * offsets)
+{
+	uint32_t worstLoadUs = 0;
+	uint32_t loadUs;
+	uint32_t tick;
+
+	for (tick = offset; tick < hyperperiod; tick += periodTicks)
+	{
+		loadUs = SCHED_getTickLoad(tick, offsets);
+		if (loadUs > worstLoadUs)
+		{
+			worstLoadUs = loadUs;
+		}
+	}
+
+	return worstLoadUs;
+}
+#endif
+
+/* 
+  Description: This function shall set first release of every task and compute worst tick load,
+               with SCHED_OFFSETS_AUTO tasks are placed one by one, shortest period first, at the
+               offset where the worst load of their releases is the lowest
+
+  Input:
+        1- offsets -> array of MAX_TASKS_NUMBER to hold first release of tasks in ticks
+
+  Output: void
+
+ */
+static void SCHED_placeTasks (uint32_t * offsets)
+{
+	uint32_t hyperperiod = SCHED_getHyperperiod();
+	uint32_t local_taskLoop;
+	uint32_t tick;
+	uint32_t loadUs;
+#if SCHED_OFFSETS_MODE == SCHED_OFFSETS_AUTO
+	uint32_t local_placeLoop;
+	uint32_t task;
+	uint32_t offset;
+	uint32_t bestOffset;
+	uint32_t bestLoadUs;
+
+	/* Event tasks are not released by ticks, they are placed already */
+	for (local_taskLoop = 0; local_taskLoop < MAX_TASKS_NUMBER; local_taskLoop ++)
+	{
+		offsets[local_taskLoop] = (sysTasksInfo[local_taskLoop].periodTicks == 0) ? 0 : OFFSET_NOT_PLACED;
+	}
+
+	for (local_placeLoop = 0; local_placeLoop < MAX_TASKS_NUMBER; local_placeLoop ++)
+	{
+		/* Next task is the unplaced one with the shortest period, then the longest execution time */
+		task = MAX_TASKS_NUMBER;
+		for (local_taskLoop = 0; local_taskLoop < MAX_TASKS_NUMBER; local_taskLoop ++)
+		{
+			if (offsets[local_taskLoop] == OFFSET_NOT_PLACED &&
+					(task == MAX_TASKS_NUMBER ||
+					sysTasksInfo[local_taskLoop].periodTicks < sysTasksInfo[task].periodTicks ||
+					(sysTasksInfo[local_taskLoop].periodTicks == sysTasksInfo[task].periodTicks &&
+					sysTasksInfo[local_taskLoop].execUs > sysTasksInfo[task].execUs)))
+			{
+				task = local_taskLoop;
+			}
+		}
+
+		/* All periodic tasks are placed */
+		if (task == MAX_TASKS_NUMBER)
+		{
+			break;
+		}
+
+		/* Trying every offset within task period, the earliest one wins ties */
+		bestOffset = 0;
+		bestLoadUs = 0xFFFFFFFF;
+		for (offset = 0; offset < sysTasksInfo[task].periodTicks && offset < hyperperiod; offset ++)
+		{
+			loadUs = SCHED_getReleasesLoad(sysTasksInfo[task].periodTicks, offset, hyperperiod, offsets);
+			if (loadUs < bestLoadUs)
+			{
+				bestLoadUs = loadUs;
+				bestOffset = offset;
+			}
+		}
+
+		offsets[task] = bestOffset;
+	}
+#else
+	for (local_taskLoop = 0; local_taskLoop < MAX_TASKS_NUMBER; local_taskLoop ++)
+	{
+		offsets[local_taskLoop] = sysTasksInfo[local_taskLoop].delayTicks;
+	}
+#endif
+
+	worstTickLoadUs = 0;
+	for (tick = 0; tick < hyperperiod; tick ++)
+	{
+		loadUs = SCHED_getTickLoad(tick, offsets);
+		if (loadUs > worstTickLoadUs)
+		{
+			worstTickLoadUs = loadUs;
+		}
+	}
+}
+
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+/* This function shall return time since scheduler start in micro seconds, it wraps every 2^32 us */
+static uint32_t SCHED_getTimeUs (void)
+{
+	uint64_t timestampUs;
+
+	SCHED_getTimestampUs(&timestampUs);
+
+	return (uint32_t)timestampUs;
+}
+
+/* This function shall clear statistics of a task */
+static void SCHED_clearStats (sysTask_t * task)
+{
+	task->stats.runs = 0;
+	task->stats.overruns = 0;
+	task->stats.minExecUs = 0xFFFFFFFF;
+	task->stats.maxExecUs = 0;
+	task->stats.avgExecUs = 0;
+	task->stats.minStartDelayUs = 0xFFFFFFFF;
+	task->stats.maxStartDelayUs = 0;
+	task->execSumUs = 0;
+	task->execSumRuns = 0;
+}
+
+/* 
+  Description: This function shall add one run of a task to its statistics
+
+  Input:
+        1- task -> Address of system task
+        2- startUs -> time runnable was called at
+        3- endUs -> time runnable returned at
+
+  Output: void
+
+ */
+static void SCHED_recordRun (sysTask_t * task, uint32_t startUs, uint32_t endUs)
+{
+	uint32_t execUs = endUs - startUs;
+	uint32_t startDelayUs = startUs - task->releaseUs;
+
+	task->stats.runs++;
+
+	if (execUs < task->stats.minExecUs)
+	{
+		task->stats.minExecUs = execUs;
+	}
+	if (execUs > task->stats.maxExecUs)
+	{
+		task->stats.maxExecUs = execUs;
+	}
+	/* Task took longer than its period, event tasks have no period */
+	if (task->periodTicks != 0 && execUs > task->periodTicks * TICK_USEC)
+	{
+		task->stats.overruns++;
+	}
+
+	if (startDelayUs < task->stats.minStartDelayUs)
+	{
+		task->stats.minStartDelayUs = startDelayUs;
+	}
+	if (startDelayUs > task->stats.maxStartDelayUs)
+	{
+		task->stats.maxStartDelayUs = startDelayUs;
+	}
+
+	/* Halving sum and runs before sum wraps keeps average of a long running task */
+	if (task->execSumUs + execUs < task->execSumUs)
+	{
+		task->execSumUs /= 2;
+		task->execSumRuns /= 2;
+	}
+	task->execSumUs += execUs;
+	task->execSumRuns++;
+	task->stats.avgExecUs = task->execSumUs / task->execSumRuns;
+}
+
+/* This function shall call task runnable and record its statistics */
+static void SCHED_runTask (sysTask_t * task)
+{
+	uint32_t startUs;
+
+	startUs = SCHED_getTimeUs();
+	TASK_INFO(task)->runnable();
+	SCHED_recordRun(task, startUs, SCHED_getTimeUs());
+}
+#endif
+
+/* This function shall call task runnable, run is measured and supervised when enabled */
+static void SCHED_execute (sysTask_t * task)
+{
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	SCHED_startRun(task);
+#endif
+
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+	SCHED_runTask(task);
+#else
+	TASK_INFO(task)->runnable();
+#endif
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	SCHED_endRun(task);
+#endif
+}
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+/* This function shall mark task ready to be picked unless it waits in a delay, interrupts shall be held by caller */
+static void SCHED_setReady (sysTask_t * task)
+{
+	uint32_t taskIndex = task - sysTasks;
+
+	if (!task->waiting)
+	{
+		readyTasks[taskIndex / 32] |= 1UL << (taskIndex % 32);
+	}
+}
+
+/* This function shall stop task from being picked, interrupts shall be held by caller */
+static void SCHED_clearReady (sysTask_t * task)
+{
+	uint32_t taskIndex = task - sysTasks;
+
+	readyTasks[taskIndex / 32] &= ~(1UL << (taskIndex % 32));
+}
+
+/* This function shall queue task waiting until wakeTick, after tasks that wake before or with it. Interrupts shall be held by caller */
+static void SCHED_insertWaiting (sysTask_t * task)
+{
+	sysTask_t ** link = &waitQueue;
+
+	/* Ticks to wake are compared from now so order stays right when tick count wraps */
+	while (*link && (uint32_t)((*link)->wakeTick - tickCount) <= (uint32_t)(task->wakeTick - tickCount))
+	{
+		link = &(*link)->nextWaiting;
+	}
+
+	task->nextWaiting = *link;
+	*link = task;
+}
+
+/* This function shall unlink task from the wait queue, interrupts shall be held by caller */
+static void SCHED_removeWaiting (sysTask_t * task)
+{
+	sysTask_t ** link = &waitQueue;
+
+	while (*link && *link != task)
+	{
+		link = &(*link)->nextWaiting;
+	}
+
+	if (*link)
+	{
+		*link = task->nextWaiting;
+	}
+	task->waiting = 0;
+}
+#endif
+
+/* 
+  Description: This function shall process ticks, tasks due within them are executed once
+               or skipped according to SCHED_CATCHUP_POLICY
+
+  Input:
+        1- ticks -> number of ticks to process, the last one is the current tick
+
+  Output: void
+
+ */
+static void SCHED_processTicks (uint32_t ticks)
+{
+	sysTask_t * dueList = 0;
+	sysTask_t ** dueLink = &dueList;
+	sysTask_t * dueTask;
+	sysTask_t * nextDueTask;
+	uint32_t dueOffset = 0;
+	uint32_t lastRelease;
+	uint32_t periodTicks;
+
+	/* Taking tasks due within processed ticks, they are all at the queue head */
+	while (readyQueue && dueOffset + readyQueue->remainTicksToExec < ticks)
+	{
+		dueTask = readyQueue;
+		readyQueue = dueTask->next;
+
+		/* Keeping offset of due tick from the first processed tick */
+		dueOffset += dueTask->remainTicksToExec;
+		dueTask->remainTicksToExec = dueOffset;
+
+		*dueLink = dueTask;
+		dueLink = &dueTask->next;
+	}
+	*dueLink = 0;
+
+	/* Decrementing remain ticks of the queue head only, the rest are relative to it */
+	if (readyQueue)
+	{
+		readyQueue->remainTicksToExec -= ticks - dueOffset;
+	}
+
+	for (dueTask = dueList; dueTask; dueTask = nextDueTask)
+	{
+		nextDueTask = dueTask->next;
+		periodTicks = dueTask->periodTicks;
+
+		/* Suspended or deleted by a task that ran before it */
+		if (dueTask->state != TASK_STATE_ACTIVE)
+		{
+			dueTask->queued = 0;
+			continue;
+		}
+
+		/* Last release of task within processed ticks */
+		lastRelease = dueTask->remainTicksToExec;
+		lastRelease += ((ticks - 1 - lastRelease) / periodTicks) * periodTicks;
+
+#if SCHED_CATCHUP_POLICY == SCHED_CATCHUP_SKIP
+		/* Only a release at the current tick is executed */
+		if (lastRelease == ticks - 1)
+#endif
+		{
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+			dueTask->releaseUs = (processedTicks + 1 + lastRelease) * TICK_USEC;
+#endif
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+			SCHED_releaseRun(dueTask, processedTicks + 1 + lastRelease);
+#endif
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+			/* Calling task runnable */
+			SCHED_execute(dueTask);
+#else
+			/* Task runs from its own context once it has the highest priority */
+			dueTask->ready = 1;
+			SCHED_setReady(dueTask);
+#endif
+		}
+
+		/* Queueing task again at its next release to keep its phase, unless it was suspended while running */
+		if (dueTask->state == TASK_STATE_ACTIVE)
+		{
+			SCHED_insertTask(dueTask, lastRelease + periodTicks - ticks);
+		}
+		else
+		{
+			dueTask->queued = 0;
+		}
+	}
+
+	processedTicks += ticks;
+}
+
+/* 
+  Description: This function shall be the scheduler itself
+
+  Input:
+        1- ticks -> number of ticks raised since scheduler last ran
+
+  Output: void
+
+ */
+static void SCHED_scheduler (uint32_t ticks)
+{
+#if SCHED_CATCHUP_POLICY == SCHED_CATCHUP_RUN_ALL
+	/* Missed ticks are processed one by one so every missed release runs in order */
+	while (ticks > 1)
+	{
+		SCHED_processTicks(1);
+		ticks--;
+	}
+#endif
+
+	SCHED_processTicks(ticks);
+}
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+/* This function shall execute event tasks activated since the last dispatch, in table order */
+static void SCHED_dispatchEvents (void)
+{
+	uint32_t local_taskLoop;
+
+	/* Cleared before scanning, an activation during the scan is dispatched on the next pass */
+	eventsPending = 0;
+
+	for (local_taskLoop = 0; local_taskLoop < SCHED_TASKS_POOL_SIZE; local_taskLoop ++)
+	{
+		if (sysTasks[local_taskLoop].activated)
+		{
+			sysTasks[local_taskLoop].activated = 0;
+			SCHED_execute(&sysTasks[local_taskLoop]);
+		}
+	}
+}
+#endif
+
+#if SCHED_IDLE_MODE != SCHED_IDLE_BUSY_WAIT
+/* 
+  Description: This function shall close CPU load window once it covers one second,
+               load is the part of the window core did not sleep
+
+  Input:
+        1- ticks -> number of ticks passed since the last call
+
+  Output: void
+
+ */
+static void SCHED_updateLoad (uint32_t ticks)
+{
+	uint32_t windowUs;
+	uint32_t sleptUs;
+
+	loadWindowTicks += ticks;
+
+	if (loadWindowTicks >= LOAD_WINDOW_TICKS)
+	{
+		windowUs = loadWindowTicks * TICK_USEC;
+		sleptUs = idleUs;
+		if (sleptUs > windowUs)
+		{
+			sleptUs = windowUs;
+		}
+
+		/* Window is at least one second so dividing it by 1000 first keeps precision without overflow */
+		cpuLoadPermille = 1000 - sleptUs / (windowUs / 1000);
+
+		idleUs = 0;
+		loadWindowTicks = 0;
+	}
+}
+#endif
+
+#if SCHED_IDLE_MODE != SCHED_IDLE_BUSY_WAIT
+/* 
+  Description: This function shall sleep until the next interrupt and count slept time as idle,
+               SysTick keeps firing every tick so core wakes at least once per tick
+
+  Input: void
+
+  Output: void
+
+ */
+static void SCHED_sleep (void)
+{
+	uint32_t startUs;
+	uint8_t tickPending;
+
+	/* Interrupts are held so a tick can not slip between the check and WFI, it still wakes the core */
+	CORE_SET_PRIMASK(1);
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	if (pendingTicks || eventsPending)
+	{
+		CORE_SET_PRIMASK(0);
+		return;
+	}
+#endif
+
+	startUs = SCHED_getTickElapsedUs();
+	sleepStartUs = startUs;
+	sleeping = 1;
+
+	CORE_WFI();
+
+	/* Sleep ends before the wake up source is served, a tick ends it itself at tick boundary */
+	NVIC_getSystemPending(SYS_HANDLER_SYSTICK, &tickPending);
+	if (!tickPending)
+	{
+		SCHED_endSleep(0);
+	}
+
+	CORE_SET_PRIMASK(0);
+}
+#endif
+
+#if SCHED_IDLE_MODE == SCHED_IDLE_TICKLESS
+/* This function shall set the longest sleep SysTick can hold at current clock */
+static void SCHED_setMaxIdleTicks (void)
+{
+	uint32_t maxTimeUs;
+
+	/* One tick is kept for the rest of the current tick */
+	SYSTICK_getMaxTimeUs(&maxTimeUs, systemClockMHz);
+	maxIdleTicks = maxTimeUs / TICK_USEC;
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	/* Watchdog is refreshed by ticks, so sleep shall end before it expires */
+	if (maxIdleTicks > (SCHED_WATCHDOG_TIMEOUT_MS * 1000ULL) / TICK_USEC)
+	{
+		maxIdleTicks = (SCHED_WATCHDOG_TIMEOUT_MS * 1000ULL) / TICK_USEC;
+	}
+#endif
+	if (maxIdleTicks > 0)
+	{
+		maxIdleTicks--;
+	}
+}
+
+/* 
+  Description: This function shall sleep until the next due task instead of waking every tick,
+               SysTick is stretched up to the due tick and ticks passed while sleeping are
+               removed from the queue head when core wakes up
+
+  Input: void
+
+  Output: void
+
+ */
+static void SCHED_idleTickless (void)
+{
+	uint32_t idleTicks;
+	uint32_t tickElapsedUs;
+	uint32_t sleptUs;
+	uint32_t passedUs;
+	uint32_t passedTicks;
+	uint8_t tickPending;
+
+	/* Next tick already has work, nothing is due or SysTick can not hold a longer tick, sleeping until next tick */
+	if (readyQueue == 0 || readyQueue->remainTicksToExec == 0 || maxIdleTicks == 0)
+	{
+		SCHED_sleep();
+		return;
+	}
+
+	idleTicks = readyQueue->remainTicksToExec;
+	if (idleTicks > maxIdleTicks)
+	{
+		idleTicks = maxIdleTicks;
+	}
+
+	/* Interrupts are held so a tick can not slip between the check and WFI, it still wakes the core */
+	CORE_SET_PRIMASK(1);
+
+	if (pendingTicks || eventsPending)
+	{
+		CORE_SET_PRIMASK(0);
+		return;
+	}
+
+	/* Stretching current tick up to the due tick */
+	SYSTICK_stop();
+	NVIC_getSystemPending(SYS_HANDLER_SYSTICK, &tickPending);
+	if (tickPending)
+	{
+		/* Tick ended just before counter was stopped, next tick starts now */
+		SYSTICK_start();
+		CORE_SET_PRIMASK(0);
+		return;
+	}
+	tickElapsedUs = SCHED_getTickElapsedUs();
+	SYSTICK_setTimeUs((idleTicks + 1) * TICK_USEC - tickElapsedUs, systemClockMHz);
+	SYSTICK_start();
+
+	CORE_WFI();
+
+	/* Interrupts are still held, so time base is fixed before any handler reads it */
+	SYSTICK_stop();
+	SYSTICK_getElapsedUs(&sleptUs, systemClockMHz);
+	NVIC_getSystemPending(SYS_HANDLER_SYSTICK, &tickPending);
+	if (tickPending)
+	{
+		/* Counter reached the due tick and reloaded */
+		sleptUs += (idleTicks + 1) * TICK_USEC - tickElapsedUs;
+	}
+	passedUs = tickElapsedUs + sleptUs;
+	passedTicks = passedUs / TICK_USEC;
+	idleUs += sleptUs;
+
+	/* Restarting with the rest of the current tick */
+	SCHED_restartTick(passedUs % TICK_USEC);
+
+	/* Tick raised by SysTick is counted by its handler, the others passed while sleeping */
+	if (tickPending && passedTicks > 0)
+	{
+		passedTicks--;
+	}
+	SCHED_countTicks(passedTicks);
+	processedTicks += passedTicks;
+	SCHED_updateLoad(passedTicks);
+
+	CORE_SET_PRIMASK(0);
+
+	if (passedTicks > readyQueue->remainTicksToExec)
+	{
+		passedTicks = readyQueue->remainTicksToExec;
+	}
+	readyQueue->remainTicksToExec -= passedTicks;
+}
+#endif
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+/* This function shall return the ready task with the highest priority, tasks with the same priority keep table order */
+static sysTask_t * SCHED_getHighestReady (void)
+{
+	sysTask_t * highest = &idleTask;
+	sysTask_t * task;
+	uint32_t local_wordLoop;
+	uint32_t bits;
+
+	/* Only ready tasks are visited, lowest slot first */
+	for (local_wordLoop = 0; local_wordLoop < READY_WORDS; local_wordLoop ++)
+	{
+		bits = readyTasks[local_wordLoop];
+		while (bits)
+		{
+			task = &sysTasks[local_wordLoop * 32 + __builtin_ctz(bits)];
+			if (task->priority < highest->priority)
+			{
+				highest = task;
+			}
+			bits &= bits - 1;
+		}
+	}
+
+	return highest;
+}
+
+/* This function shall wake tasks whose delay reached its wake tick, they are at the head of the wait queue */
+static void SCHED_wakeTasks (void)
+{
+	sysTask_t * task;
+
+	while (waitQueue && TICK_REACHED(waitQueue->wakeTick))
+	{
+		task = waitQueue;
+		waitQueue = task->nextWaiting;
+		task->waiting = 0;
+		SCHED_setReady(task);
+	}
+}
+
+/* This function shall be the callback function of the scheduler in preemptive mode */
+static void SCHED_tick (void)
+{
+	if (!timeBaseRunning)
+	{
+		startWraps++;
+		return;
+	}
+
+	/* Ready tasks are also changed by interrupts that activate tasks */
+	CORE_SET_PRIMASK(1);
+
+	SCHED_countTicks(1);
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	SCHED_supervise();
+#endif
+	SCHED_wakeTasks();
+
+#if SCHED_IDLE_MODE == SCHED_IDLE_SLEEP
+	SCHED_endSleep(1);
+	SCHED_updateLoad(1);
+#endif
+
+	/* Marking due tasks ready, every tick is processed in interrupt so none is missed */
+	SCHED_scheduler(1);
+
+	/* Switching context only if a due task has higher priority than the running one */
+	if (SCHED_getHighestReady()->priority < currentTask->priority)
+	{
+		NVIC_setPendSV();
+	}
+
+	CORE_SET_PRIMASK(0);
+}
+
+/* This function shall run the running task once for its release and give processor to the next ready task */
+static void SCHED_serveRelease (void)
+{
+	/* Release is taken before the run, one that comes during the run is served by the next one */
+	CORE_SET_PRIMASK(1);
+	currentTask->ready = 0;
+	CORE_SET_PRIMASK(0);
+
+	/* Execution time includes time task spent preempted */
+	SCHED_execute(currentTask);
+
+	/* Giving processor to the next ready task until task is released again */
+	CORE_SET_PRIMASK(1);
+	if (!currentTask->ready)
+	{
+		SCHED_clearReady(currentTask);
+	}
+	NVIC_setPendSV();
+	CORE_SET_PRIMASK(0);
+}
+
+/* This function shall be the body of every task context, runnable is called once per release */
+static void SCHED_taskThread (void)
+{
+	while (1)
+	{
+		SCHED_serveRelease();
+	}
+}
+
+/* This function shall be the body of idle context, it runs when no task is ready */
+static void SCHED_idleThread (void)
+{
+	while (1)
+	{
+#if SCHED_IDLE_MODE == SCHED_IDLE_SLEEP
+		SCHED_sleep();
+#endif
+	}
+}
+
+/* 
+  Description: This function shall prepare task stack as if task was preempted at its entry
+
+  Input:
+        1- task -> Address of system task
+        2- stack -> Address of the first word of task stack
+        3- entry -> function where task context starts
+
+  Output: void
+
+ */
+static void SCHED_initContext (sysTask_t * task, uint32_t * stack, taskRunnable_t entry)
+{
+	uint32_t local_wordLoop;
+
+	task->stackPointer = &stack[SCHED_STACK_SIZE_WORDS - CONTEXT_WORDS];
+	task->waiting = 0;
+
+	for (local_wordLoop = 0; local_wordLoop < CONTEXT_WORDS; local_wordLoop ++)
+	{
+		task->stackPointer[local_wordLoop] = 0;
+	}
+
+	/* Exception return requires PC with thumb bit cleared and T bit set in xPSR */
+	task->stackPointer[CONTEXT_PC] = (uint32_t)(unsigned long)entry & ~1UL;
+	task->stackPointer[CONTEXT_XPSR] = INITIAL_XPSR;
+}
+
+/* 
+  Description: This function shall be called by PendSV to save running task context and select next task,
+               interrupts are held by PendSV and idle time was already ended by idle context
+
+  Input:
+        1- stackPointer -> process stack pointer of running task after saving R4-R11, 0 on first switch
+
+  Output: process stack pointer of the next task
+
+ */
+uint32_t * SCHED_switchContext (uint32_t * stackPointer)
+{
+	/* First switch leaves main context which is never resumed */
+	if (stackPointer)
+	{
+		currentTask->stackPointer = stackPointer;
+	}
+
+	currentTask = SCHED_getHighestReady();
+
+	return currentTask->stackPointer;
+}
+
+/* PendSV exception handler, switches task contexts on process stack */
+#ifndef HOST_SIM
+__attribute__((naked)) void PendSV_Handler (void)
+{
+	asm volatile (
+		"cpsid i                   \n"
+		"mrs   r0, psp             \n"
+		"cbz   r0, 1f              \n"
+		"stmdb r0!, {r4-r11}       \n"
+		"1:                        \n"
+		"bl    SCHED_switchContext \n"
+		"ldmia r0!, {r4-r11}       \n"
+		"msr   psp, r0             \n"
+		"cpsie i                   \n"
+		/* EXC_RETURN 0xFFFFFFFD, thread mode on process stack */
+		"mvn   lr, #2              \n"
+		"bx    lr                  \n"
+	);
+}
+#else
+/* Context switch can not be simulated, host build keeps tables and statistics for analysis only */
+void PendSV_Handler (void)
+{
+}
+#endif
+#endif
+
+/* This function shall keep SysTick right after RCC changed system clock */
+static void SCHED_clockChanged (uint32_t event, const rccClocks_t * clocks)
+{
+	/* Clocks are read back by SCHED_updateSystemClock */
+	(void)clocks;
+
+	if (event == RCC_CLOCK_POST_CHANGE)
+	{
+		SCHED_updateSystemClock();
+	}
+}
+
+/* 
+  Description: This function shall initiate scheduler by:
+                1- Queueing tasks of scheduling table
+                2- Setting Timer
+                3- Setting callback function
+
+  Input: void
+
+  Output: status_t
+
+ */
+status_t SCHED_init(void)
+{
+	status_t status = status_Ok;
+
+
+	/* Queueing tasks at their first release, periods and offsets are already in ticks */
+	uint32_t local_taskLoop;
+	uint32_t offsets[MAX_TASKS_NUMBER];
+
+	sysTasksInfo = getSysTasksInfo();
+
+	SCHED_placeTasks(offsets);
+
+	readyQueue = 0;
+	tickOverruns = 0;
+
+	for (local_taskLoop = 0; local_taskLoop < SCHED_TASKS_POOL_SIZE; local_taskLoop ++)
+	{
+		sysTasks[local_taskLoop].queued = 0;
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+		sysTasks[local_taskLoop].activated = 0;
+#else
+		sysTasks[local_taskLoop].ready = 0;
+#endif
+
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+		SCHED_clearStats(&sysTasks[local_taskLoop]);
+#endif
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+		sysTasks[local_taskLoop].running = 0;
+		sysTasks[local_taskLoop].missed = 0;
+		sysTasks[local_taskLoop].deadlineMisses = 0;
+#endif
+
+		/* Pool slots after the table are free for SCHED_createTask */
+		if (local_taskLoop >= MAX_TASKS_NUMBER)
+		{
+			sysTasks[local_taskLoop].state = TASK_STATE_FREE;
+			continue;
+		}
+
+		sysTasks[local_taskLoop].state = TASK_STATE_ACTIVE;
+		sysTasks[local_taskLoop].periodTicks = sysTasksInfo[local_taskLoop].periodTicks;
+
+		/* Event tasks are released by SCHED_activateTask only */
+		if (sysTasksInfo[local_taskLoop].periodTicks != 0)
+		{
+			SCHED_insertTask(&sysTasks[local_taskLoop], offsets[local_taskLoop]);
+		}
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+		sysTasks[local_taskLoop].priority = sysTasksInfo[local_taskLoop].priority;
+		SCHED_initContext(&sysTasks[local_taskLoop], taskStacks[local_taskLoop], SCHED_taskThread);
+#endif
+	}
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+	for (local_taskLoop = 0; local_taskLoop < READY_WORDS; local_taskLoop ++)
+	{
+		readyTasks[local_taskLoop] = 0;
+	}
+	waitQueue = 0;
+
+	idleTask.priority = IDLE_TASK_PRIORITY;
+	SCHED_initContext(&idleTask, taskStacks[SCHED_TASKS_POOL_SIZE], SCHED_idleThread);
+
+	/* Main context is accounted as idle until first context switch */
+	currentTask = &idleTask;
+
+	NVIC_setSystemPriority(SYS_HANDLER_PENDSV, PENDSV_PRIORITY);
+#endif
+
+	/* Setting Timer */
+	uint32_t currentClock;
+	RCC_getSystemFrequency(&currentClock);
+	SYSTICK_init();
+	if (SYSTICK_setTimeUs(TICK_USEC,currentClock/1000000) != status_Ok)
+	{
+		/* Tick does not fit SysTick at this clock */
+		status = status_Nok;
+	}
+
+	systemClockMHz = currentClock/1000000;
+
+	/* SysTick follows every later change of system clock */
+	if (RCC_registerClockCallback(SCHED_clockChanged) != status_Ok)
+	{
+		status = status_Nok;
+	}
+
+#if SCHED_IDLE_MODE != SCHED_IDLE_BUSY_WAIT
+	idleUs = 0;
+	loadWindowTicks = 0;
+	cpuLoadPermille = LOAD_NOT_MEASURED;
+#endif
+
+	tickCount = 0;
+	tickCountHigh = 0;
+	timeBaseRunning = 0;
+	processedTicks = 0;
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	/* Stuck task is reported only if watchdog caused the reset, backup register outlives other resets */
+	uint32_t resetFlags;
+	uint16_t savedTask = 0;
+	BKP_init();
+	RCC_getResetFlags(&resetFlags);
+	BKP_read(SCHED_RESET_BKP_REGISTER, &savedTask);
+	resetTask = NO_RESET_TASK;
+	if ((resetFlags & RESET_FLAG_IWDG) && (savedTask & RESET_MARKER_MASK) == RESET_MARKER)
+	{
+		resetTask = savedTask & ~RESET_MARKER_MASK;
+	}
+	BKP_write(SCHED_RESET_BKP_REGISTER, 0);
+	supervisorTripped = 0;
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	runningTask = 0;
+#endif
+#endif
+
+#if SCHED_IDLE_MODE == SCHED_IDLE_TICKLESS
+	SCHED_setMaxIdleTicks();
+#endif
+
+	/* Setting callback function */
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	pendingTicks = 0;
+	eventsPending = 0;
+	SYSTICK_setCallback(SCHED_countTick);
+#else
+	SYSTICK_setCallback(SCHED_tick);
+#endif
+
+
+	return status;
+}
+/* 
+  Description: This function shall start scheduler
+
+  Input: void
+
+  Output: status_t
+
+ */
+status_t SCHED_start(void)
+{
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	uint32_t ticks;
+
+#endif
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+#ifndef HOST_SIM
+	/* Process stack is zero so first PendSV does not save main context */
+	asm volatile ("MSR PSP, %0" : : "r" (0) : "memory");
+#endif
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	IWDG_start(SCHED_WATCHDOG_TIMEOUT_MS);
+#endif
+
+	/* Starting timer */
+	timeBaseRunning = 1;
+	SYSTICK_start();
+
+	/* Switching to the first task, main context is left for good */
+	NVIC_setPendSV();
+
+	while (1)
+	{
+	}
+#else
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	IWDG_start(SCHED_WATCHDOG_TIMEOUT_MS);
+#endif
+
+	/* Starting timer */
+	timeBaseRunning = 1;
+	SYSTICK_start();
+
+	while (CORE_KEEP_RUNNING())
+	{
+		if (pendingTicks)
+		{
+			/* Taking pending ticks while SysTick can not add to them */
+			CORE_SET_PRIMASK(1);
+			ticks = pendingTicks;
+			pendingTicks = 0;
+			CORE_SET_PRIMASK(0);
+
+			if (ticks > 1)
+			{
+				tickOverruns += ticks - 1;
+			}
+#if SCHED_IDLE_MODE != SCHED_IDLE_BUSY_WAIT
+			SCHED_updateLoad(ticks);
+#endif
+			SCHED_scheduler(ticks);
+		}
+
+		/* Events are dispatched after every batch of ticks, so periodic load can not starve them */
+		if (eventsPending)
+		{
+			SCHED_dispatchEvents();
+		}
+#if SCHED_IDLE_MODE == SCHED_IDLE_TICKLESS
+		else if (!pendingTicks)
+		{
+			SCHED_idleTickless();
+		}
+#elif SCHED_IDLE_MODE == SCHED_IDLE_SLEEP
+		else if (!pendingTicks)
+		{
+			SCHED_sleep();
+		}
+#endif
+	}
+
+	/* Loop ends on host only, once the simulated run is over */
+	SYSTICK_stop();
+
+	return status_Ok;
+#endif
+}
+
+/* 
+  Description: This function shall activate an event task, it can be called from interrupts.
+               Task runs on the next scheduler pass, in preemptive mode it preempts the running
+               task right away if it has higher priority
+
+  Input:
+        1- taskIndex -> index of event task in tasks pool
+
+  Output: status_t
+
+ */
+status_t SCHED_activateTask (uint32_t taskIndex)
+{
+	status_t status = status_Ok;
+
+	/* Periodic tasks are released by ticks only, a suspended task ignores activations */
+	if (taskIndex >= SCHED_TASKS_POOL_SIZE || sysTasks[taskIndex].state != TASK_STATE_ACTIVE ||
+			sysTasks[taskIndex].periodTicks != 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+		sysTasks[taskIndex].releaseUs = SCHED_getTimeUs();
+#endif
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+		CORE_SET_PRIMASK(1);
+		SCHED_releaseRun(&sysTasks[taskIndex], tickCount);
+		CORE_SET_PRIMASK(0);
+#endif
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+		/* Single byte stores, no lock is needed against the scheduler clearing them */
+		sysTasks[taskIndex].activated = 1;
+		eventsPending = 1;
+#else
+		CORE_SET_PRIMASK(1);
+		sysTasks[taskIndex].ready = 1;
+		SCHED_setReady(&sysTasks[taskIndex]);
+		if (sysTasks[taskIndex].priority < currentTask->priority)
+		{
+			NVIC_setPendSV();
+		}
+		CORE_SET_PRIMASK(0);
+#endif
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall create a task in a free slot of the dynamic tasks pool
+
+  Input:
+        1- runnable -> task function
+        2- periodUs -> task period in micro seconds, a multiple of TICK_USEC, or 0 for an event task
+        3- offsetUs -> delay of the first release from the next tick in micro seconds, a multiple of TICK_USEC
+        4- priority -> used by SCHED_MODE_PREEMPTIVE only, 0 is the highest priority
+        5- taskIndex -> pointer to hold index of created task
+
+  Output: status_t
+
+ */
+status_t SCHED_createTask (taskRunnable_t runnable, uint32_t periodUs, uint32_t offsetUs, uint8_t priority, uint32_t * taskIndex)
+{
+	status_t status = status_Nok;
+
+#if SCHED_DYNAMIC_TASKS_NUMBER > 0
+	uint32_t local_taskLoop;
+	sysTask_t * task;
+	sysTasksInfo_t * info;
+
+	if (runnable == 0 || taskIndex == 0 || periodUs % TICK_USEC != 0 || offsetUs % TICK_USEC != 0)
+	{
+		return status_Nok;
+	}
+
+	CORE_SET_PRIMASK(1);
+
+	for (local_taskLoop = MAX_TASKS_NUMBER; local_taskLoop < SCHED_TASKS_POOL_SIZE; local_taskLoop ++)
+	{
+		task = &sysTasks[local_taskLoop];
+
+		/* A deleted task may still be in the due list or have a pending run */
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+		if (task->state == TASK_STATE_FREE && !task->queued)
+#else
+		if (task->state == TASK_STATE_FREE && !task->queued && !task->ready)
+#endif
+		{
+			info = &dynamicTasksInfo[local_taskLoop - MAX_TASKS_NUMBER];
+			info->runnable = runnable;
+			info->periodTicks = periodUs / TICK_USEC;
+			info->delayTicks = offsetUs / TICK_USEC;
+			info->priority = priority;
+			info->execUs = 0;
+			info->deadlineTicks = info->periodTicks;
+
+			task->periodTicks = info->periodTicks;
+			task->state = TASK_STATE_ACTIVE;
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+			task->activated = 0;
+#else
+			task->priority = priority;
+			SCHED_initContext(task, taskStacks[local_taskLoop], SCHED_taskThread);
+#endif
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+			SCHED_clearStats(task);
+#endif
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+			task->running = 0;
+			task->missed = 0;
+			task->deadlineMisses = 0;
+#endif
+
+			if (task->periodTicks != 0)
+			{
+				SCHED_insertTask(task, info->delayTicks);
+			}
+
+			*taskIndex = local_taskLoop;
+			status = status_Ok;
+			break;
+		}
+	}
+
+	CORE_SET_PRIMASK(0);
+#endif
+
+	return status;
+}
+
+/* 
+  Description: This function shall delete a task created by SCHED_createTask, its slot is freed
+
+  Input:
+        1- taskIndex -> index of task in tasks pool
+
+  Output: status_t
+
+ */
+status_t SCHED_deleteTask (uint32_t taskIndex)
+{
+	status_t status = status_Ok;
+
+	if (taskIndex < MAX_TASKS_NUMBER || taskIndex >= SCHED_TASKS_POOL_SIZE ||
+			sysTasks[taskIndex].state == TASK_STATE_FREE)
+	{
+		status = status_Nok;
+	}
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+	/* Running task context can not be recycled under its own feet */
+	else if (&sysTasks[taskIndex] == currentTask)
+	{
+		status = status_Nok;
+	}
+#endif
+	else
+	{
+		CORE_SET_PRIMASK(1);
+		SCHED_removeTask(&sysTasks[taskIndex]);
+		sysTasks[taskIndex].state = TASK_STATE_FREE;
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+		sysTasks[taskIndex].activated = 0;
+#else
+		/* A preempted run or a delay of the task is dropped with it */
+		sysTasks[taskIndex].ready = 0;
+		SCHED_clearReady(&sysTasks[taskIndex]);
+		SCHED_removeWaiting(&sysTasks[taskIndex]);
+#endif
+		CORE_SET_PRIMASK(0);
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall suspend a task, it is taken out of the delta queue so it costs
+               nothing per tick, a run already started or released completes
+
+  Input:
+        1- taskIndex -> index of task in tasks pool
+
+  Output: status_t
+
+ */
+status_t SCHED_suspendTask (uint32_t taskIndex)
+{
+	status_t status = status_Ok;
+
+	if (taskIndex >= SCHED_TASKS_POOL_SIZE || sysTasks[taskIndex].state != TASK_STATE_ACTIVE)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		CORE_SET_PRIMASK(1);
+		SCHED_removeTask(&sysTasks[taskIndex]);
+		sysTasks[taskIndex].state = TASK_STATE_SUSPENDED;
+		CORE_SET_PRIMASK(0);
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall resume a suspended task, a periodic task is due at the next tick
+               then every period
+
+  Input:
+        1- taskIndex -> index of task in tasks pool
+
+  Output: status_t
+
+ */
+status_t SCHED_resumeTask (uint32_t taskIndex)
+{
+	status_t status = status_Ok;
+
+	if (taskIndex >= SCHED_TASKS_POOL_SIZE || sysTasks[taskIndex].state != TASK_STATE_SUSPENDED)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		CORE_SET_PRIMASK(1);
+		sysTasks[taskIndex].state = TASK_STATE_ACTIVE;
+
+		/* A task suspended while it was due is still linked in the due list and keeps its release */
+		if (sysTasks[taskIndex].periodTicks != 0 && !sysTasks[taskIndex].queued)
+		{
+			SCHED_insertTask(&sysTasks[taskIndex], 0);
+		}
+		CORE_SET_PRIMASK(0);
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall change period of a periodic task, the release already queued
+               is kept and the new period applies from it
+
+  Input:
+        1- taskIndex -> index of task in tasks pool
+        2- periodUs -> new period in micro seconds, a non zero multiple of TICK_USEC
+
+  Output: status_t
+
+ */
+status_t SCHED_setTaskPeriod (uint32_t taskIndex, uint32_t periodUs)
+{
+	status_t status = status_Ok;
+
+	/* Event tasks stay event tasks */
+	if (taskIndex >= SCHED_TASKS_POOL_SIZE || sysTasks[taskIndex].state == TASK_STATE_FREE ||
+			sysTasks[taskIndex].periodTicks == 0 || periodUs < TICK_USEC || periodUs % TICK_USEC != 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		CORE_SET_PRIMASK(1);
+		sysTasks[taskIndex].periodTicks = periodUs / TICK_USEC;
+		CORE_SET_PRIMASK(0);
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall compute first release of every task as SCHED_init does
+
+  Input:
+        1- offsets -> array of MAX_TASKS_NUMBER to hold first release of tasks in ticks
+
+  Output: status_t
+
+ */
+status_t SCHED_getTaskOffsets (uint32_t * offsets)
+{
+	status_t status = status_Ok;
+
+	if (offsets == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		sysTasksInfo = getSysTasksInfo();
+		SCHED_placeTasks(offsets);
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall get the worst load of a single tick over the hyperperiod
+
+  Input:
+        1- loadUs -> pointer to hold the sum of execution times of the worst tick in micro seconds
+
+  Output: status_t
+
+ */
+status_t SCHED_getWorstTickLoad (uint32_t * loadUs)
 {
-	task_t * appTask;
-	uint32_t remainTicksToExec;
-	uint32_t periodTicks;
+	status_t status = status_Ok;
 
-}sysTask_t;
+	if (loadUs == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*loadUs = worstTickLoadUs;
+	}
 
-static uint8_t OSFlag;
+	return status;
+}
 
-static sysTask_t sysTasks[MAX_TASKS_NUMBER];
+/* 
+  Description: This function shall get number of ticks that passed while scheduler was still
+               processing an earlier tick
 
-/* This function shall be the callback function of the scheduler */
-static void setOSFlag (void)
+  Input:
+        1- overruns -> pointer to hold number of overrun ticks since scheduler start
+
+  Output: status_t
+
+ */
+status_t SCHED_getTickOverruns (uint32_t * overruns)
 {
-	/* Setting flag to start the scheduler */
-	OSFlag = 1;
+	status_t status = status_Ok;
+
+	if (overruns == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*overruns = tickOverruns;
+	}
+
+	return status;
 }
 
 /* 
-  Description: This function shall be the scheduler itself
+  Description: This function shall get time since scheduler start in micro seconds from tick count
+               and SysTick counter, it does not wrap. A tick is counted late when its handler is held,
+               counter reload is then seen from pending flag, so time never goes back.
+               Interrupts shall not be held by caller for more than one tick
 
-  Input: void
+  Input:
+        1- timestampUs -> pointer to hold time in micro seconds
 
-  Output: void
+  Output: status_t
 
  */
-static void SCHED_scheduler (void)
+status_t SCHED_getTimestampUs (uint64_t * timestampUs)
 {
-	uint32_t local_taskLoop;
+	uint32_t ticks;
+	uint32_t ticksHigh;
+	uint32_t elapsedUs;
+	uint8_t tickPending;
+
+	if (timestampUs == 0)
+	{
+		return status_Nok;
+	}
 
-	/* Looping on existed tasks */
-	for (local_taskLoop = 0; local_taskLoop < MAX_TASKS_NUMBER ; local_taskLoop ++)
+	/* Time base stays at zero until scheduler starts, SysTick may count delays meanwhile */
+	if (!timeBaseRunning)
 	{
-		/* Task should be executed at current tick */
-		if (sysTasks[local_taskLoop].remainTicksToExec == 0)
+		*timestampUs = 0;
+		return status_Ok;
+	}
+
+	/* Reading again if a tick was counted meanwhile, tick count is the sequence of time base */
+	do
+	{
+		ticks = tickCount;
+		ticksHigh = tickCountHigh;
+		SYSTICK_getElapsedUs(&elapsedUs, systemClockMHz);
+		NVIC_getSystemPending(SYS_HANDLER_SYSTICK, &tickPending);
+		if (tickPending)
 		{
-			/* Calling task runnable */
-			sysTasks[local_taskLoop].appTask->runnable();
-			/* Updating remain ticks to execute with the initial value to start again */
-			sysTasks[local_taskLoop].remainTicksToExec = sysTasks[local_taskLoop].periodTicks;
+			/* Counter may have reloaded after it was read, it is read again after the reload */
+			SYSTICK_getElapsedUs(&elapsedUs, systemClockMHz);
 		}
-		/* Decrementing remain ticks to execute each tick */
-		sysTasks[local_taskLoop].remainTicksToExec--;
 	}
+	while (ticks != tickCount);
+
+	if (tickPending)
+	{
+		ticks++;
+		if (ticks == 0)
+		{
+			ticksHigh++;
+		}
+	}
+
+	*timestampUs = ((((uint64_t)ticksHigh) << 32) | ticks) * TICK_USEC + elapsedUs;
+
+	return status_Ok;
 }
 
+/* This function shall return 1 while time base is before the given time */
+static uint8_t SCHED_isBefore (uint64_t timestampUs)
+{
+	uint64_t nowUs;
+
+	SCHED_getTimestampUs(&nowUs);
+
+	return (nowUs < timestampUs) ? 1 : 0;
+}
 
 /* 
-  Description: This function shall initiate scheduler by:
-                1- Assigning tasks' array required fields
-                2- Setting Timer
-                3- Setting callback function
+  Description: This function shall apply the current system clock to SysTick, LOAD is derived
+               again for one tick and the current tick goes on with its rest at the new clock,
+               so task periods and time base stay right. It is called on every change RCC
+               notifies, it shall be called right after the system clock is changed otherwise
 
   Input: void
 
   Output: status_t
 
  */
-status_t SCHED_init(void)
+status_t SCHED_updateSystemClock (void)
 {
 	status_t status = status_Ok;
+	uint32_t currentClock;
+	uint32_t tickElapsedUs;
+	uint32_t primask;
 
+	RCC_getSystemFrequency(&currentClock);
 
-	/* Assigning tasks' array required fields */
-	uint32_t local_taskLoop;
-
-	sysTasksInfo_t * sysTasksInfo = getSysTasksInfo();
+	/* RCC notifies from its own critical sections, interrupts held by the caller stay held */
+	primask = CORE_GET_PRIMASK();
+	CORE_SET_PRIMASK(1);
 
-	for (local_taskLoop = 0; local_taskLoop < MAX_TASKS_NUMBER; local_taskLoop ++)
+	if (!timeBaseRunning)
 	{
-		sysTasks[local_taskLoop].appTask = sysTasksInfo[local_taskLoop].appTask;
-		sysTasks[local_taskLoop].remainTicksToExec = sysTasksInfo[local_taskLoop].delayTicks;
-		sysTasks[local_taskLoop].periodTicks = (sysTasksInfo[local_taskLoop].appTask->periodicTime / TICK_USEC);
+		systemClockMHz = currentClock / 1000000;
+		status = SYSTICK_setTimeUs(TICK_USEC, systemClockMHz);
 	}
+	else
+	{
+		/* Time passed of the current tick is taken at the old clock */
+		SYSTICK_stop();
+		SYSTICK_getElapsedUs(&tickElapsedUs, systemClockMHz);
 
-	/* Setting Timer */
+		systemClockMHz = currentClock / 1000000;
+		status = SCHED_restartTick(tickElapsedUs);
+	}
+
+#if SCHED_IDLE_MODE == SCHED_IDLE_TICKLESS
+	SCHED_setMaxIdleTicks();
+#endif
+
+	CORE_SET_PRIMASK(primask);
+
+	return status;
+}
+
+/* 
+  Description: This function shall wait the given time on SysTick counter before scheduler starts,
+               counter is loaded for the rest of the wait at most a period at a time and stopped
+               with one tick loaded again once the wait is over. Interrupts shall not be held
+
+  Input:
+        1- delayUs -> time to wait in micro seconds
+
+  Output: status_t
+
+ */
+static status_t SCHED_waitCounterUs (uint64_t delayUs)
+{
+	status_t status = status_Ok;
 	uint32_t currentClock;
+	uint32_t clockMHz;
+	uint32_t maxTimeUs;
+	uint32_t periodUs;
+	uint32_t wraps;
+
 	RCC_getSystemFrequency(&currentClock);
+	clockMHz = currentClock / 1000000;
+	if (SYSTICK_getMaxTimeUs(&maxTimeUs, clockMHz) != status_Ok)
+	{
+		return status_Nok;
+	}
+
+	/* Scheduler may not be initialized yet, its callback counts periods until it starts */
 	SYSTICK_init();
-	SYSTICK_setTimeUs(TICK_USEC,currentClock/1000000);
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	SYSTICK_setCallback(SCHED_countTick);
+#else
+	SYSTICK_setCallback(SCHED_tick);
+#endif
 
-	/* Setting callback function */
-	SYSTICK_setCallback(setOSFlag);
+	while (delayUs > 0 && status == status_Ok)
+	{
+		periodUs = (delayUs > maxTimeUs) ? maxTimeUs : (uint32_t)delayUs;
+		status = SYSTICK_setTimeUs(periodUs, clockMHz);
+		if (status == status_Ok)
+		{
+			wraps = startWraps;
+			SYSTICK_start();
+			REG_WAIT_WHILE(startWraps == wraps);
+			SYSTICK_stop();
+			delayUs -= periodUs;
+		}
+	}
 
+	/* Tick set by SCHED_init is loaded again for SCHED_start */
+	if (systemClockMHz != 0 && SYSTICK_setTimeUs(TICK_USEC, systemClockMHz) != status_Ok)
+	{
+		status = status_Nok;
+	}
 
 	return status;
 }
+
 /* 
-  Description: This function shall start scheduler
+  Description: This function shall return after the time base reaches the given time.
+               In SCHED_MODE_PREEMPTIVE a task waits whole ticks out of processor, so the other
+               tasks and idle run, and only polls the rest of the last tick. A caller that can
+               not leave processor, a task in SCHED_MODE_COOPERATIVE or an interrupt, only polls
+               a time within the current tick. A later time returns status_Pending at once, the
+               task shall return and check it with SCHED_isTimeReached on its next runs, so ticks
+               are not held by polling. Before scheduler starts, time base is zero and
+               the wait is counted on SysTick. Interrupts shall not be held and it shall not be
+               called from SysTick callbacks
+
+  Input:
+        1- timestampUs -> time of time base to wait for in micro seconds
+
+  Output: status_t, status_Pending if the time is after the current tick and caller can not leave processor
+
+ */
+status_t SCHED_delayUntil (uint64_t timestampUs)
+{
+	uint64_t nowUs;
+	uint8_t canLeave = 0;
+	uint8_t laterTick;
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+	uint32_t wakeTick;
+#endif
+
+	if (!timeBaseRunning)
+	{
+		return SCHED_waitCounterUs(timestampUs);
+	}
+
+	SCHED_getTimestampUs(&nowUs);
+	laterTick = (timestampUs / TICK_USEC > nowUs / TICK_USEC);
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+	canLeave = (CORE_GET_IPSR() == 0);
+
+	/* Task is woken at the start of the tick the time falls in */
+	if (canLeave && laterTick)
+	{
+		wakeTick = (uint32_t)(timestampUs / TICK_USEC);
+
+		CORE_SET_PRIMASK(1);
+		if (!TICK_REACHED(wakeTick))
+		{
+			currentTask->wakeTick = wakeTick;
+			currentTask->waiting = 1;
+			SCHED_clearReady(currentTask);
+			SCHED_insertWaiting(currentTask);
+			NVIC_setPendSV();
+		}
+		CORE_SET_PRIMASK(0);
+	}
+#endif
+
+	/* Polling past the tick boundary would hold the next tick and every task due at it */
+	if (!canLeave && laterTick)
+	{
+		return status_Pending;
+	}
+
+	REG_WAIT_WHILE(SCHED_isBefore(timestampUs));
+
+	return status_Ok;
+}
+
+/* 
+  Description: This function shall return after the given time passed, see SCHED_delayUntil
+
+  Input:
+        1- delayUs -> time to wait in micro seconds
+
+  Output: status_t
+
+ */
+status_t SCHED_delayUs (uint32_t delayUs)
+{
+	uint64_t nowUs;
+
+	SCHED_getTimestampUs(&nowUs);
+
+	return SCHED_delayUntil(nowUs + delayUs);
+}
+
+/* 
+  Description: This function shall return after the given time passed, see SCHED_delayUntil
+
+  Input:
+        1- delayMs -> time to wait in milli seconds
+
+  Output: status_t
+
+ */
+status_t SCHED_delayMs (uint32_t delayMs)
+{
+	uint64_t nowUs;
+
+	SCHED_getTimestampUs(&nowUs);
+
+	return SCHED_delayUntil(nowUs + (uint64_t)delayMs * 1000);
+}
+
+/* 
+  Description: This function shall tell if the time base reached the given time without waiting,
+               a task waits for a time by returning and checking again on its next run, it is
+               how a task of SCHED_MODE_COOPERATIVE waits past the current tick
+
+  Input:
+        1- timestampUs -> time of time base in micro seconds
+        2- reached -> pointer to hold 1 if time is reached, 0 otherwise
+
+  Output: status_t
+
+ */
+status_t SCHED_isTimeReached (uint64_t timestampUs, uint8_t * reached)
+{
+	status_t status = status_Ok;
+
+	if (reached == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*reached = !SCHED_isBefore(timestampUs);
+	}
+
+	return status;
+}
+
+/* 
+  Description: This function shall get CPU load of the last second from time core slept while idle,
+               status_Nok until the first second is measured
+
+  Input:
+        1- loadPermille -> pointer to hold CPU load in permille
+
+  Output: status_t
+
+ */
+status_t SCHED_getCpuLoad (uint32_t * loadPermille)
+{
+	status_t status = status_Ok;
+
+#if SCHED_IDLE_MODE == SCHED_IDLE_BUSY_WAIT
+	/* Polling loop never sleeps so idle time is not measured */
+	status = status_Nok;
+#else
+	if (loadPermille == 0 || cpuLoadPermille == LOAD_NOT_MEASURED)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*loadPermille = cpuLoadPermille;
+	}
+#endif
+
+	return status;
+}
+
+/* 
+  Description: This function shall get number of runs of a task that completed after their deadline
+
+  Input:
+        1- taskIndex -> index of task in tasks pool
+        2- misses -> pointer to hold number of missed deadlines since task was created
+
+  Output: status_t
+
+ */
+status_t SCHED_getDeadlineMisses (uint32_t taskIndex, uint32_t * misses)
+{
+	status_t status = status_Ok;
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	if (taskIndex >= SCHED_TASKS_POOL_SIZE || misses == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*misses = sysTasks[taskIndex].deadlineMisses;
+	}
+#else
+	/* Deadlines are not supervised */
+	(void)taskIndex;
+	(void)misses;
+	status = status_Nok;
+#endif
+
+	return status;
+}
+
+/* 
+  Description: This function shall get task that was stuck when watchdog reset the system
+
+  Input:
+        1- taskIndex -> pointer to hold index of stuck task in tasks pool, SCHED_TASKS_POOL_SIZE
+                        if scheduler itself stopped processing ticks
+
+  Output: status_t
+
+ */
+status_t SCHED_getResetTask (uint32_t * taskIndex)
+{
+	status_t status = status_Ok;
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	if (taskIndex == 0 || resetTask == NO_RESET_TASK)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*taskIndex = resetTask;
+	}
+#else
+	/* Stuck task is not recorded */
+	(void)taskIndex;
+	status = status_Nok;
+#endif
+
+	return status;
+}
+
+/* 
+  Description: This function shall get execution statistics of a task, SCHED_TASK_STATS shall be enabled
+
+  Input:
+        1- taskIndex -> index of task in tasks pool
+        2- stats -> pointer to hold task statistics
+
+  Output: status_t
+
+ */
+status_t SCHED_getTaskStats (uint32_t taskIndex, taskStats_t * stats)
+{
+	status_t status = status_Ok;
+
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+	if (taskIndex >= SCHED_TASKS_POOL_SIZE || stats == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		/* Task may be updating its statistics from another context */
+		CORE_SET_PRIMASK(1);
+		*stats = sysTasks[taskIndex].stats;
+		CORE_SET_PRIMASK(0);
+
+		/* Task has not run yet */
+		if (stats->runs == 0)
+		{
+			stats->minExecUs = 0;
+			stats->minStartDelayUs = 0;
+		}
+	}
+#else
+	status = status_Nok;
+#endif
+
+	return status;
+}
+
+/* 
+  Description: This function shall clear execution statistics of all tasks
 
   Input: void
 
   Output: status_t
 
  */
-status_t SCHED_start(void)
+status_t SCHED_resetTaskStats (void)
 {
-	/* Starting timer */
-	SYSTICK_start();
+	status_t status = status_Ok;
 
-	while (1)
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+	uint32_t local_taskLoop;
+
+	CORE_SET_PRIMASK(1);
+	for (local_taskLoop = 0; local_taskLoop < SCHED_TASKS_POOL_SIZE; local_taskLoop ++)
+	{
+		SCHED_clearStats(&sysTasks[local_taskLoop]);
+	}
+	CORE_SET_PRIMASK(0);
+#else
+	status = status_Nok;
+#endif
+
+	return status;
+}
+
+/* 
+  Description: This function shall write statistics of all tasks in a compact binary form
+
+  Input:
+        1- buffer -> address of buffer to hold the dump
+        2- bufferSize -> size of buffer in bytes
+        3- dumpSize -> pointer to hold number of bytes written
+
+  Output: status_t
+
+ */
+status_t SCHED_dumpTaskStats (uint8_t * buffer, uint32_t bufferSize, uint32_t * dumpSize)
+{
+	status_t status = status_Ok;
+
+#if SCHED_TASK_STATS == SCHED_STATS_ENABLE
+	taskStats_t stats;
+	uint32_t words[STATS_WORDS_NUMBER];
+	uint32_t local_taskLoop;
+	uint32_t local_wordLoop;
+	uint8_t * record;
+
+	if (buffer == 0 || dumpSize == 0 ||
+			bufferSize < SCHED_STATS_DUMP_HEADER_SIZE + SCHED_TASKS_POOL_SIZE * SCHED_STATS_DUMP_RECORD_SIZE)
 	{
-		if (OSFlag)
+		status = status_Nok;
+	}
+	else
+	{
+		buffer[0] = SCHED_STATS_DUMP_VERSION;
+		buffer[1] = SCHED_TASKS_POOL_SIZE;
+		record = &buffer[SCHED_STATS_DUMP_HEADER_SIZE];
+
+		for (local_taskLoop = 0; local_taskLoop < SCHED_TASKS_POOL_SIZE; local_taskLoop ++)
 		{
-			OSFlag = 0;
-			SCHED_scheduler();
+			SCHED_getTaskStats(local_taskLoop, &stats);
+
+			words[0] = stats.runs;
+			words[1] = stats.overruns;
+			words[2] = stats.minExecUs;
+			words[3] = stats.maxExecUs;
+			words[4] = stats.avgExecUs;
+			words[5] = stats.minStartDelayUs;
+			words[6] = stats.maxStartDelayUs;
+
+			/* Little endian regardless of host reading the dump */
+			for (local_wordLoop = 0; local_wordLoop < STATS_WORDS_NUMBER; local_wordLoop ++)
+			{
+				record[0] = (uint8_t)(words[local_wordLoop]);
+				record[1] = (uint8_t)(words[local_wordLoop] >> 8);
+				record[2] = (uint8_t)(words[local_wordLoop] >> 16);
+				record[3] = (uint8_t)(words[local_wordLoop] >> 24);
+				record += 4;
+			}
 		}
+
+		*dumpSize = record - buffer;
 	}
+#else
+	status = status_Nok;
+#endif
+
+	return status;
 }
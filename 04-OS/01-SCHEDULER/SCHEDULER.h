@@ -10,23 +10,69 @@
 #ifndef SCHEDULER_H
 #define SCHEDULER_H
 
+#define SCHED_IDLE_BUSY_WAIT  1
+#define SCHED_IDLE_TICKLESS   2
+#define SCHED_IDLE_SLEEP      3
 
-typedef void (*taskRunnable_t)(void);
+#define SCHED_MODE_COOPERATIVE  1
+#define SCHED_MODE_PREEMPTIVE   2
 
-typedef struct {
-  
-  taskRunnable_t runnable;
-  uint32_t periodicTime;
-} task_t;
+#define SCHED_CATCHUP_RUN_ALL   1
+#define SCHED_CATCHUP_SKIP      2
+#define SCHED_CATCHUP_COALESCE  3
+
+#define SCHED_OFFSETS_TABLE  1
+#define SCHED_OFFSETS_AUTO   2
+
+#define SCHED_STATS_DISABLE  1
+#define SCHED_STATS_ENABLE   2
+
+#define SCHED_SUPERVISION_DISABLE  1
+#define SCHED_SUPERVISION_ENABLE   2
 
+/* Binary dump of task statistics, version and tasks number bytes then one record per task */
+#define SCHED_STATS_DUMP_VERSION      1
+#define SCHED_STATS_DUMP_HEADER_SIZE  2
+#define SCHED_STATS_DUMP_RECORD_SIZE  28
 
+/* Tasks of SCHED_TASKS_LIST followed by slots for tasks created at run time */
+#define SCHED_TASKS_POOL_SIZE  (MAX_TASKS_NUMBER + SCHED_DYNAMIC_TASKS_NUMBER)
+
+
+typedef void (*taskRunnable_t)(void);
+
+/* Task entry of scheduling table, generated in flash by SCHEDULER_cfg.c from SCHED_TASKS_LIST */
 typedef struct
 {
-  const task_t * appTask;
+  taskRunnable_t runnable;
+  /* 0 for event tasks */
+  uint32_t periodTicks;
   uint32_t delayTicks;
+  /* Used by SCHED_MODE_PREEMPTIVE only, 0 is the highest priority */
+  uint8_t priority;
+  /* Worst execution time estimate, 0 when unknown */
+  uint32_t execUs;
+  /* Ticks from release by which a run shall complete, 0 for no deadline */
+  uint32_t deadlineTicks;
 }sysTasksInfo_t;
 
 
+/*
+  Execution statistics of a task, times are in micro seconds.
+  Start delay is measured from the tick task was due at, start jitter is maxStartDelayUs - minStartDelayUs
+*/
+typedef struct
+{
+  uint32_t runs;
+  uint32_t overruns;
+  uint32_t minExecUs;
+  uint32_t maxExecUs;
+  uint32_t avgExecUs;
+  uint32_t minStartDelayUs;
+  uint32_t maxStartDelayUs;
+}taskStats_t;
+
+
 /* 
   Description: This function shall initiate scheduler by setting timer and setting callback function
   
@@ -39,7 +85,8 @@ extern status_t SCHED_init(void);
 
 
 /* 
-  Description: This function shall start scheduler
+  Description: This function shall start scheduler, it does not return. A host build of
+               SCHED_MODE_COOPERATIVE returns once the run allowed by SIM_runFor is over
   
   Input: void
         
@@ -48,5 +95,277 @@ extern status_t SCHED_init(void);
  */
 extern status_t SCHED_start(void);
 
+/* 
+  Description: This function shall activate an event task (periodUs 0 in SCHED_TASKS_LIST),
+               it can be called from interrupts. Task runs on the next scheduler pass, in
+               preemptive mode it preempts the running task right away if it has higher priority
+  
+  Input: 
+        1- taskIndex -> index of event task in tasks pool, SCHED_TASK_ID_name for tasks of SCHED_TASKS_LIST
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_activateTask (uint32_t taskIndex);
+
+/* 
+  Description: This function shall create a task in a free slot of the dynamic tasks pool,
+               deadline of a periodic task is its period
+  
+  Input: 
+        1- runnable -> task function
+        2- periodUs -> task period in micro seconds, a multiple of TICK_USEC, or 0 for an event task
+        3- offsetUs -> delay of the first release from the next tick in micro seconds, a multiple of TICK_USEC
+        4- priority -> used by SCHED_MODE_PREEMPTIVE only, 0 is the highest priority
+        5- taskIndex -> pointer to hold index of created task
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_createTask (taskRunnable_t runnable, uint32_t periodUs, uint32_t offsetUs, uint8_t priority, uint32_t * taskIndex);
+
+/* 
+  Description: This function shall delete a task created by SCHED_createTask, its slot is freed
+  
+  Input: 
+        1- taskIndex -> index of task in tasks pool
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_deleteTask (uint32_t taskIndex);
+
+/* 
+  Description: This function shall suspend a task, a suspended task costs nothing per tick
+  
+  Input: 
+        1- taskIndex -> index of task in tasks pool
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_suspendTask (uint32_t taskIndex);
+
+/* 
+  Description: This function shall resume a suspended task, a periodic task is due at the next tick
+  
+  Input: 
+        1- taskIndex -> index of task in tasks pool
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_resumeTask (uint32_t taskIndex);
+
+/* 
+  Description: This function shall change period of a periodic task from its next release
+  
+  Input: 
+        1- taskIndex -> index of task in tasks pool
+        2- periodUs -> new period in micro seconds, a non zero multiple of TICK_USEC
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_setTaskPeriod (uint32_t taskIndex, uint32_t periodUs);
+
+/* 
+  Description: This function shall compute first release of every task as SCHED_init does,
+               according to SCHED_OFFSETS_MODE, and update the worst tick load
+  
+  Input: 
+        1- offsets -> array of MAX_TASKS_NUMBER to hold first release of tasks in ticks
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_getTaskOffsets (uint32_t * offsets);
+
+/* 
+  Description: This function shall get the worst load of a single tick over the hyperperiod,
+               computed by SCHED_init from execUs of every task released at that tick
+  
+  Input: 
+        1- loadUs -> pointer to hold the sum of execution times of the worst tick in micro seconds
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_getWorstTickLoad (uint32_t * loadUs);
+
+/* 
+  Description: This function shall get number of ticks that passed while scheduler was still
+               processing an earlier tick, they are handled by SCHED_CATCHUP_POLICY
+  
+  Input: 
+        1- overruns -> pointer to hold number of overrun ticks since scheduler start
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_getTickOverruns (uint32_t * overruns);
+
+/* 
+  Description: This function shall get time since scheduler start in micro seconds, tick count
+               and SysTick counter are combined so it has sub tick resolution and never wraps,
+               it may be called from tasks and interrupts
+  
+  Input: 
+        1- timestampUs -> pointer to hold time in micro seconds
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_getTimestampUs (uint64_t * timestampUs);
+
+/* 
+  Description: This function shall apply the current system clock to SysTick so task periods and
+               time base stay right, it shall be called right after the system clock is changed
+  
+  Input: void
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_updateSystemClock (void);
+
+/* 
+  Description: This function shall return after the time base reaches the given time, in
+               SCHED_MODE_PREEMPTIVE other tasks run while a task waits whole ticks. A task of
+               SCHED_MODE_COOPERATIVE or an interrupt only waits for a time within the current
+               tick, a later time returns status_Pending at once: the task returns and checks the
+               time with SCHED_isTimeReached on its next runs. Before scheduler starts, time base
+               is zero and the wait is counted on SysTick
+  
+  Input: 
+        1- timestampUs -> time of time base to wait for in micro seconds
+        
+  Output: status_t, status_Pending if the time is after the current tick and caller can not wait for it
+
+ */
+extern status_t SCHED_delayUntil (uint64_t timestampUs);
+
+/* 
+  Description: This function shall return after the given time passed, see SCHED_delayUntil
+  
+  Input: 
+        1- delayUs -> time to wait in micro seconds
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_delayUs (uint32_t delayUs);
+
+/* 
+  Description: This function shall return after the given time passed, see SCHED_delayUntil
+  
+  Input: 
+        1- delayMs -> time to wait in milli seconds
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_delayMs (uint32_t delayMs);
+
+/* 
+  Description: This function shall tell if the time base reached the given time without waiting,
+               a task waits for a time by returning and checking again on its next run, it is
+               how a task of SCHED_MODE_COOPERATIVE waits past the current tick
+  
+  Input: 
+        1- timestampUs -> time of time base in micro seconds
+        2- reached -> pointer to hold 1 if time is reached, 0 otherwise
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_isTimeReached (uint64_t timestampUs, uint8_t * reached);
+
+/* 
+  Description: This function shall get CPU load of the last second, measured from time core slept
+               while idle, SCHED_IDLE_MODE shall not be SCHED_IDLE_BUSY_WAIT. It is status_Nok
+               until the first second after scheduler start is measured
+  
+  Input: 
+        1- loadPermille -> pointer to hold CPU load in permille
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_getCpuLoad (uint32_t * loadPermille);
+
+/* 
+  Description: This function shall get number of runs of a task that completed after their deadline,
+               SCHED_SUPERVISION shall be enabled
+  
+  Input: 
+        1- taskIndex -> index of task in tasks pool
+        2- misses -> pointer to hold number of missed deadlines since task was created
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_getDeadlineMisses (uint32_t taskIndex, uint32_t * misses);
+
+/* 
+  Description: This function shall get task that was stuck when watchdog reset the system,
+               it is read by SCHED_init so it is valid after it. SCHED_SUPERVISION shall be enabled
+  
+  Input: 
+        1- taskIndex -> pointer to hold index of stuck task in tasks pool, SCHED_TASKS_POOL_SIZE
+                        if scheduler itself stopped processing ticks
+        
+  Output: status_t, status_Nok if last reset was not caused by supervision
+
+ */
+extern status_t SCHED_getResetTask (uint32_t * taskIndex);
+
+/* 
+  Description: This function shall get execution statistics of a task, SCHED_TASK_STATS shall be enabled
+  
+  Input: 
+        1- taskIndex -> index of task in tasks pool
+        2- stats -> pointer to hold task statistics
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_getTaskStats (uint32_t taskIndex, taskStats_t * stats);
+
+/* 
+  Description: This function shall clear execution statistics of all tasks
+  
+  Input: void
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_resetTaskStats (void);
+
+/* 
+  Description: This function shall write statistics of all tasks in a compact binary form,
+               every record holds taskStats_t fields in order as 32 bits little endian words
+  
+  Input: 
+        1- buffer -> address of buffer to hold the dump
+        2- bufferSize -> size of buffer in bytes, at least SCHED_STATS_DUMP_HEADER_SIZE + 
+                         SCHED_TASKS_POOL_SIZE * SCHED_STATS_DUMP_RECORD_SIZE
+        3- dumpSize -> pointer to hold number of bytes written
+        
+  Output: status_t
+
+ */
+extern status_t SCHED_dumpTaskStats (uint8_t * buffer, uint32_t bufferSize, uint32_t * dumpSize);
+
+/* 
+  Description: This function shall return the system tasks array configured in SCHEDULER_cfg.c
+  
+  Input: void
+        
+  Output: Address of the first element of sysTasksInfo array
+
+ */
+extern const sysTasksInfo_t * getSysTasksInfo (void);
+
 
 #endif
@@ -13,15 +13,34 @@
 #include "SCHEDULER_cfg.h"
 
 
-task_t task1;
-task_t task2;
+/* Application runnables */
+#define SCHED_TASK(name, runnable, periodUs, offsetUs, priority, execUs, deadlineUs) \
+	extern void runnable (void);
+SCHED_TASKS_LIST
+#undef SCHED_TASK
 
-const sysTasksInfo_t sysTasksInfo [MAX_TASKS_NUMBER] = {
-		{&task1,0},
-		{&task2,0}
+/* Periods, offsets and deadlines shall be whole ticks so converting them to ticks loses nothing */
+#define SCHED_TASK(name, runnable, periodUs, offsetUs, priority, execUs, deadlineUs) \
+	_Static_assert((periodUs) % TICK_USEC == 0, \
+			#name " period shall be a multiple of TICK_USEC, or 0 for an event task"); \
+	_Static_assert((offsetUs) % TICK_USEC == 0, #name " offset shall be a multiple of TICK_USEC"); \
+	_Static_assert((deadlineUs) % TICK_USEC == 0, #name " deadline shall be a multiple of TICK_USEC");
+SCHED_TASKS_LIST
+#undef SCHED_TASK
+
+/* Scheduling table, converted to ticks at compile time and kept in flash */
+#define SCHED_TASK(name, runnable, periodUs, offsetUs, priority, execUs, deadlineUs) \
+	{runnable, (periodUs) / TICK_USEC, (offsetUs) / TICK_USEC, priority, execUs, \
+			((deadlineUs) ? (deadlineUs) : (periodUs)) / TICK_USEC},
+static const sysTasksInfo_t sysTasksInfo [] = {
+		SCHED_TASKS_LIST
 };
+#undef SCHED_TASK
+
+_Static_assert(sizeof(sysTasksInfo) / sizeof(sysTasksInfo[0]) == MAX_TASKS_NUMBER,
+		"SCHED_TASKS_LIST shall hold MAX_TASKS_NUMBER tasks");
 
-extern sysTasksInfo_t * getSysTasksInfo (void)
+extern const sysTasksInfo_t * getSysTasksInfo (void)
 {
-	return &sysTasksInfo;
+	return sysTasksInfo;
 }
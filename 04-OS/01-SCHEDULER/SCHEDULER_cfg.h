@@ -14,8 +14,110 @@
 #define MAX_TASKS_NUMBER  2
 #define TICK_USEC         1000000
 
-extern task_t task1;
-extern task_t task2;
+/*
+  Tasks of the system, one line per task in execution order of tasks due at the same tick:
+    SCHED_TASK(name, runnable, periodUs, offsetUs, priority, execUs, deadlineUs)
+  1- name     -> task name, used in build error messages
+  2- runnable -> task function defined by application, void runnable (void)
+  3- periodUs -> task period in micro seconds, a multiple of TICK_USEC, or 0 for an event
+                 task that runs only when activated by SCHED_activateTask
+  4- offsetUs -> delay of the first release in micro seconds, a multiple of TICK_USEC,
+                 ignored with SCHED_OFFSETS_AUTO
+  5- priority -> used by SCHED_MODE_PREEMPTIVE only, 0 is the highest priority
+  6- execUs   -> worst execution time in micro seconds (maxExecUs of task statistics),
+                 used to balance tick load, 0 when unknown
+  7- deadlineUs -> time from release by which a run shall complete in micro seconds, a multiple
+                 of TICK_USEC, 0 for the period (event tasks then have no deadline)
+  Table is built as constant data at compile time, so list shall hold MAX_TASKS_NUMBER tasks
+*/
+#define SCHED_TASKS_LIST \
+		SCHED_TASK(task1, task1Runnable, 1000000, 0, 0, 0, 0) \
+		SCHED_TASK(task2, task2Runnable, 1000000, 0, 0, 0, 0)
+
+/* Task identifiers in table order, SCHED_TASK_ID_name */
+#define SCHED_TASK(name, runnable, periodUs, offsetUs, priority, execUs, deadlineUs) SCHED_TASK_ID_##name,
+typedef enum
+{
+	SCHED_TASKS_LIST
+}schedTaskId_t;
+#undef SCHED_TASK
+
+/*
+  Select how first release of every task is set
+  Options are:
+  1- SCHED_OFFSETS_TABLE -> offsetUs of SCHED_TASKS_LIST
+  2- SCHED_OFFSETS_AUTO  -> SCHED_init spreads tasks over the hyperperiod so that the
+                            worst tick load is as low as possible (greedy, shortest period first)
+*/
+#define SCHED_OFFSETS_MODE  SCHED_OFFSETS_TABLE
+
+/* Ticks over which tick load is evaluated when hyperperiod of tasks is longer */
+#define SCHED_MAX_HYPERPERIOD_TICKS  1000
+
+/* Slots of the tasks pool for tasks created at run time by SCHED_createTask */
+#define SCHED_DYNAMIC_TASKS_NUMBER  2
+
+/*
+  Select what scheduler does between ticks
+  Options are:
+  1- SCHED_IDLE_BUSY_WAIT -> polls tick flag, SysTick fires every tick
+  2- SCHED_IDLE_TICKLESS  -> SysTick is reprogrammed up to the next due task and core sleeps (WFI),
+                             cooperative mode only
+  3- SCHED_IDLE_SLEEP     -> core sleeps (WFI) until the next interrupt, SysTick fires every tick
+*/
+#define SCHED_IDLE_MODE   SCHED_IDLE_SLEEP
+
+/*
+  Select how tasks are executed
+  Options are:
+  1- SCHED_MODE_COOPERATIVE -> due tasks run to completion in table order from SCHED_start loop
+  2- SCHED_MODE_PREEMPTIVE  -> every task has its own stack, a due task preempts a running task
+                               with lower priority (SCHED_TASKS_LIST priority) through PendSV context switch
+*/
+#define SCHED_MODE        SCHED_MODE_COOPERATIVE
+
+/*
+  Select what scheduler does with ticks that passed while tasks of an earlier tick were running,
+  used by SCHED_MODE_COOPERATIVE only as preemptive mode handles every tick in SysTick interrupt
+  Options are:
+  1- SCHED_CATCHUP_RUN_ALL  -> missed ticks are processed one by one, every missed release runs
+  2- SCHED_CATCHUP_SKIP     -> missed releases are dropped, tasks run again at their next release
+  3- SCHED_CATCHUP_COALESCE -> every task with missed releases runs once
+  Task phases are kept with all options
+*/
+#define SCHED_CATCHUP_POLICY  SCHED_CATCHUP_RUN_ALL
+
+/*
+  Select whether execution time, start delay and overruns of every task are recorded
+  Options are:
+  1- SCHED_STATS_DISABLE
+  2- SCHED_STATS_ENABLE  -> SysTick counter is read before and after every runnable
+*/
+#define SCHED_TASK_STATS  SCHED_STATS_ENABLE
+
+/* Stack size of every task in words, used by SCHED_MODE_PREEMPTIVE only */
+#define SCHED_STACK_SIZE_WORDS  128
+
+
+/*
+  Select supervision of tasks
+  Options are:
+  1- SCHED_SUPERVISION_DISABLE
+  2- SCHED_SUPERVISION_ENABLE  -> deadline misses are counted per task and independent watchdog is
+                                  refreshed every tick. A task running longer than SCHED_HANG_TIMEOUT_USEC,
+                                  or ticks left unprocessed that long, stops refresh so watchdog resets
+                                  the system, the task index is kept for SCHED_getResetTask
+*/
+#define SCHED_SUPERVISION  SCHED_SUPERVISION_DISABLE
+
+/* Time a run may take before its task is considered stuck, shall be longer than any task run */
+#define SCHED_HANG_TIMEOUT_USEC  5000000
+
+/* Watchdog timeout in milli seconds, shall be longer than a tick as watchdog is refreshed every tick */
+#define SCHED_WATCHDOG_TIMEOUT_MS  3000
+
+/* Backup data register holding index of the stuck task across the watchdog reset */
+#define SCHED_RESET_BKP_REGISTER  1
 
 
 #endif
@@ -0,0 +1,383 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: OS                                    */
+/* Component: SWTIMER                           */
+/* File Name: SWTIMER.c                         */
+/************************************************/
+
+
+#include "STD_TYPES.h"
+
+#include "SCHEDULER.h"
+#include "SCHEDULER_cfg.h"
+
+#include "SWTIMER.h"
+#include "SWTIMER_cfg.h"
+
+#if (SWTIMER_WHEEL_SIZE & (SWTIMER_WHEEL_SIZE - 1)) != 0
+#error "SWTIMER_WHEEL_SIZE shall be a power of 2"
+#endif
+
+#define WHEEL_MASK  (SWTIMER_WHEEL_SIZE - 1)
+
+#define TIMER_STATE_FREE     0
+#define TIMER_STATE_STOPPED  1
+#define TIMER_STATE_RUNNING  2
+
+typedef struct swTimer
+{
+	struct swTimer * next;
+	/* Address of the pointer to this timer, so timer is unlinked without walking its slot */
+	struct swTimer ** link;
+	/* Turns of the wheel left before timer expires in its slot */
+	uint32_t rounds;
+	uint32_t periodTicks;
+	swTimerCallback_t callback;
+	uint8_t mode;
+	uint8_t state;
+
+}swTimer_t;
+
+static swTimer_t swTimers[SWTIMER_MAX_TIMERS];
+
+/* Every slot holds timers expiring at the same position of the wheel */
+static swTimer_t * wheel[SWTIMER_WHEEL_SIZE];
+
+/* Slot of the last processed tick */
+static uint32_t wheelCursor;
+
+/* Tick of time base the last processed slot stands for */
+static uint32_t wheelTick;
+
+/* This function shall return the current tick of scheduler time base */
+static uint32_t SWTIMER_getTick (void)
+{
+	uint64_t nowUs;
+
+	SCHED_getTimestampUs(&nowUs);
+
+	return (uint32_t)(nowUs / TICK_USEC);
+}
+
+/* This function shall link timer to the slot it expires in, ticks from now is at least 1 */
+static void SWTIMER_insert (swTimer_t * timer, uint32_t ticks)
+{
+	swTimer_t ** slot = &wheel[(wheelCursor + ticks) & WHEEL_MASK];
+
+	timer->rounds = (ticks - 1) / SWTIMER_WHEEL_SIZE;
+
+	timer->next = *slot;
+	if (*slot)
+	{
+		(*slot)->link = &timer->next;
+	}
+	timer->link = slot;
+	*slot = timer;
+}
+
+/* This function shall unlink timer from the list it is linked to */
+static void SWTIMER_remove (swTimer_t * timer)
+{
+	*timer->link = timer->next;
+	if (timer->next)
+	{
+		timer->next->link = timer->link;
+	}
+	timer->next = 0;
+	timer->link = 0;
+}
+
+/*
+  Description: This function shall initiate software timers, all timers are freed
+
+  Input: void
+
+  Output: status_t
+
+ */
+status_t SWTIMER_init (void)
+{
+	status_t status = status_Ok;
+	uint32_t local_timerLoop;
+
+	for (local_timerLoop = 0; local_timerLoop < SWTIMER_MAX_TIMERS; local_timerLoop ++)
+	{
+		swTimers[local_timerLoop].state = TIMER_STATE_FREE;
+		swTimers[local_timerLoop].next = 0;
+		swTimers[local_timerLoop].link = 0;
+	}
+
+	for (local_timerLoop = 0; local_timerLoop < SWTIMER_WHEEL_SIZE; local_timerLoop ++)
+	{
+		wheel[local_timerLoop] = 0;
+	}
+
+	wheelCursor = 0;
+	wheelTick = SWTIMER_getTick();
+
+	return status;
+}
+
+/*
+  Description: This function shall create a stopped timer
+
+  Input:
+        1- callback -> function called when timer expires, it gets timer ID
+        2- mode -> SWTIMER_ONE_SHOT or SWTIMER_PERIODIC
+        3- timerId -> pointer to hold ID of created timer
+
+  Output: status_t
+
+ */
+status_t SWTIMER_create (swTimerCallback_t callback, uint8_t mode, uint32_t * timerId)
+{
+	status_t status = status_Nok;
+	uint32_t local_timerLoop;
+
+	if (callback == 0 || timerId == 0 || (mode != SWTIMER_ONE_SHOT && mode != SWTIMER_PERIODIC))
+	{
+		return status_Nok;
+	}
+
+	CORE_SET_PRIMASK(1);
+
+	for (local_timerLoop = 0; local_timerLoop < SWTIMER_MAX_TIMERS; local_timerLoop ++)
+	{
+		if (swTimers[local_timerLoop].state == TIMER_STATE_FREE)
+		{
+			swTimers[local_timerLoop].callback = callback;
+			swTimers[local_timerLoop].mode = mode;
+			swTimers[local_timerLoop].periodTicks = 0;
+			swTimers[local_timerLoop].state = TIMER_STATE_STOPPED;
+
+			*timerId = local_timerLoop;
+			status = status_Ok;
+			break;
+		}
+	}
+
+	CORE_SET_PRIMASK(0);
+
+	return status;
+}
+
+/*
+  Description: This function shall delete a timer, it is stopped if running
+
+  Input:
+        1- timerId -> ID of timer
+
+  Output: status_t
+
+ */
+status_t SWTIMER_delete (uint32_t timerId)
+{
+	status_t status = status_Ok;
+
+	if (timerId >= SWTIMER_MAX_TIMERS || swTimers[timerId].state == TIMER_STATE_FREE)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		CORE_SET_PRIMASK(1);
+		if (swTimers[timerId].state == TIMER_STATE_RUNNING)
+		{
+			SWTIMER_remove(&swTimers[timerId]);
+		}
+		swTimers[timerId].state = TIMER_STATE_FREE;
+		CORE_SET_PRIMASK(0);
+	}
+
+	return status;
+}
+
+/*
+  Description: This function shall start a timer, a running timer is started again from now
+
+  Input:
+        1- timerId -> ID of timer
+        2- timeUs -> timeout, and period of periodic timer, in micro seconds, a non zero multiple of TICK_USEC
+
+  Output: status_t
+
+ */
+status_t SWTIMER_start (uint32_t timerId, uint32_t timeUs)
+{
+	status_t status = status_Ok;
+
+	if (timerId >= SWTIMER_MAX_TIMERS || swTimers[timerId].state == TIMER_STATE_FREE ||
+			timeUs < TICK_USEC || timeUs % TICK_USEC != 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		CORE_SET_PRIMASK(1);
+		if (swTimers[timerId].state == TIMER_STATE_RUNNING)
+		{
+			SWTIMER_remove(&swTimers[timerId]);
+		}
+		swTimers[timerId].periodTicks = timeUs / TICK_USEC;
+		/* Slots of ticks already passed and not processed yet are ahead of the cursor */
+		SWTIMER_insert(&swTimers[timerId], swTimers[timerId].periodTicks + (SWTIMER_getTick() - wheelTick));
+		swTimers[timerId].state = TIMER_STATE_RUNNING;
+		CORE_SET_PRIMASK(0);
+	}
+
+	return status;
+}
+
+/*
+  Description: This function shall start a timer again from now with its last time
+
+  Input:
+        1- timerId -> ID of timer started at least once
+
+  Output: status_t
+
+ */
+status_t SWTIMER_restart (uint32_t timerId)
+{
+	status_t status = status_Ok;
+
+	if (timerId >= SWTIMER_MAX_TIMERS || swTimers[timerId].state == TIMER_STATE_FREE ||
+			swTimers[timerId].periodTicks == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		CORE_SET_PRIMASK(1);
+		if (swTimers[timerId].state == TIMER_STATE_RUNNING)
+		{
+			SWTIMER_remove(&swTimers[timerId]);
+		}
+		SWTIMER_insert(&swTimers[timerId], swTimers[timerId].periodTicks + (SWTIMER_getTick() - wheelTick));
+		swTimers[timerId].state = TIMER_STATE_RUNNING;
+		CORE_SET_PRIMASK(0);
+	}
+
+	return status;
+}
+
+/*
+  Description: This function shall stop a timer, its callback is not called
+
+  Input:
+        1- timerId -> ID of timer
+
+  Output: status_t
+
+ */
+status_t SWTIMER_stop (uint32_t timerId)
+{
+	status_t status = status_Ok;
+
+	if (timerId >= SWTIMER_MAX_TIMERS || swTimers[timerId].state == TIMER_STATE_FREE)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		CORE_SET_PRIMASK(1);
+		if (swTimers[timerId].state == TIMER_STATE_RUNNING)
+		{
+			SWTIMER_remove(&swTimers[timerId]);
+			swTimers[timerId].state = TIMER_STATE_STOPPED;
+		}
+		CORE_SET_PRIMASK(0);
+	}
+
+	return status;
+}
+
+/* This function shall advance the wheel by one tick and call callbacks of timers expired in the reached slot */
+static void SWTIMER_processSlot (void)
+{
+	swTimer_t * expired = 0;
+	swTimer_t * timer;
+	swTimerCallback_t callback;
+	uint32_t rounds;
+
+	CORE_SET_PRIMASK(1);
+
+	wheelCursor = (wheelCursor + 1) & WHEEL_MASK;
+	wheelTick++;
+
+	/* Slot is taken as a whole, timers of later turns are linked back to it */
+	timer = wheel[wheelCursor];
+	if (timer)
+	{
+		timer->link = &expired;
+	}
+	expired = timer;
+	wheel[wheelCursor] = 0;
+
+	CORE_SET_PRIMASK(0);
+
+	/* A callback may stop, start or delete any timer, including the ones still in expired list */
+	while (1)
+	{
+		CORE_SET_PRIMASK(1);
+
+		timer = expired;
+		if (timer == 0)
+		{
+			CORE_SET_PRIMASK(0);
+			break;
+		}
+		SWTIMER_remove(timer);
+
+		if (timer->rounds)
+		{
+			/* Next turn of the wheel reaches the same slot */
+			rounds = timer->rounds - 1;
+			SWTIMER_insert(timer, SWTIMER_WHEEL_SIZE);
+			timer->rounds = rounds;
+			callback = 0;
+		}
+		else
+		{
+			if (timer->mode == SWTIMER_PERIODIC)
+			{
+				SWTIMER_insert(timer, timer->periodTicks);
+			}
+			else
+			{
+				timer->state = TIMER_STATE_STOPPED;
+			}
+			callback = timer->callback;
+		}
+
+		CORE_SET_PRIMASK(0);
+
+		if (callback)
+		{
+			callback(timer - swTimers);
+		}
+	}
+}
+
+/*
+  Description: This function shall advance timers to the current tick of scheduler time base and
+               call callbacks of expired ones, every tick passed since the last call has its slot
+               processed in order, so a late or skipped run of the timer task loses no tick
+
+  Input: void
+
+  Output: void
+
+ */
+void SWTIMER_runnable (void)
+{
+	uint32_t nowTick = SWTIMER_getTick();
+
+	/* Callbacks may take longer than a tick, ticks passed meanwhile are processed by the next call */
+	while (wheelTick != nowTick)
+	{
+		SWTIMER_processSlot();
+	}
+}
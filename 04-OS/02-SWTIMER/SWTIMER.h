@@ -0,0 +1,107 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: OS                                    */
+/* Component: SWTIMER                           */
+/* File Name: SWTIMER.h                         */
+/************************************************/
+
+/*
+  Software timers driven by scheduler time base. SWTIMER_runnable shall be added to
+  SCHED_TASKS_LIST with a period of TICK_USEC, callbacks run from it in task context,
+  a run that comes late catches up on the ticks it missed
+*/
+
+#ifndef SWTIMER_H
+#define SWTIMER_H
+
+#define SWTIMER_ONE_SHOT  1
+#define SWTIMER_PERIODIC  2
+
+
+typedef void (*swTimerCallback_t)(uint32_t timerId);
+
+
+/* 
+  Description: This function shall initiate software timers, all timers are freed
+  
+  Input: void
+        
+  Output: status_t
+
+ */
+extern status_t SWTIMER_init (void);
+
+/* 
+  Description: This function shall create a stopped timer
+  
+  Input: 
+        1- callback -> function called when timer expires, it gets timer ID
+        2- mode -> SWTIMER_ONE_SHOT or SWTIMER_PERIODIC
+        3- timerId -> pointer to hold ID of created timer
+        
+  Output: status_t
+
+ */
+extern status_t SWTIMER_create (swTimerCallback_t callback, uint8_t mode, uint32_t * timerId);
+
+/* 
+  Description: This function shall delete a timer, it is stopped if running
+  
+  Input: 
+        1- timerId -> ID of timer
+        
+  Output: status_t
+
+ */
+extern status_t SWTIMER_delete (uint32_t timerId);
+
+/* 
+  Description: This function shall start a timer, a running timer is started again from now
+  
+  Input: 
+        1- timerId -> ID of timer
+        2- timeUs -> timeout, and period of periodic timer, in micro seconds, a non zero multiple of TICK_USEC
+        
+  Output: status_t
+
+ */
+extern status_t SWTIMER_start (uint32_t timerId, uint32_t timeUs);
+
+/* 
+  Description: This function shall start a timer again from now with its last time
+  
+  Input: 
+        1- timerId -> ID of timer started at least once
+        
+  Output: status_t
+
+ */
+extern status_t SWTIMER_restart (uint32_t timerId);
+
+/* 
+  Description: This function shall stop a timer, its callback is not called
+  
+  Input: 
+        1- timerId -> ID of timer
+        
+  Output: status_t
+
+ */
+extern status_t SWTIMER_stop (uint32_t timerId);
+
+/* 
+  Description: This function shall advance timers to the current tick of scheduler time base and
+               call callbacks of expired ones, a slot is processed for every tick passed since the
+               last call, it is the runnable of the scheduler task of the timer service
+  
+  Input: void
+        
+  Output: void
+
+ */
+extern void SWTIMER_runnable (void);
+
+
+#endif
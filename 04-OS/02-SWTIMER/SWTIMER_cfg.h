@@ -0,0 +1,25 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: OS                                    */
+/* Component: SWTIMER                           */
+/* File Name: SWTIMER_cfg.h                     */
+/************************************************/
+
+
+#ifndef SWTIMER_CFG_H
+#define SWTIMER_CFG_H
+
+/* Timers that can be created, memory of all of them is reserved at build time */
+#define SWTIMER_MAX_TIMERS  32
+
+/*
+  Slots of the timing wheel, one slot per tick, shall be a power of 2
+  Timeouts up to SWTIMER_WHEEL_SIZE ticks expire without being visited on the way,
+  longer ones are visited once per turn of the wheel
+*/
+#define SWTIMER_WHEEL_SIZE  64
+
+
+#endif
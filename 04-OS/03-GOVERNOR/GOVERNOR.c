@@ -0,0 +1,186 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: OS                                    */
+/* Component: GOVERNOR                          */
+/* File Name: GOVERNOR.c                        */
+/************************************************/
+
+
+#include "STD_TYPES.h"
+
+#include "RCC.h"
+#include "RCC_cfg.h"
+
+#include "SCHEDULER.h"
+#include "SCHEDULER_cfg.h"
+
+#include "GOVERNOR.h"
+#include "GOVERNOR_cfg.h"
+
+#if GOVERNOR_DOWN_LOAD_PERMILLE >= GOVERNOR_UP_LOAD_PERMILLE
+#error "GOVERNOR_DOWN_LOAD_PERMILLE shall be below GOVERNOR_UP_LOAD_PERMILLE"
+#endif
+
+#define GOVERNOR_PROFILE(rccProfile) rccProfile,
+static const uint32_t profiles[] = {
+		GOVERNOR_PROFILES_LIST
+};
+#undef GOVERNOR_PROFILE
+
+#define PROFILES_NUMBER  (sizeof(profiles) / sizeof(profiles[0]))
+
+#define FASTEST_PROFILE  (PROFILES_NUMBER - 1)
+
+static uint32_t currentProfile;
+
+/* HCLK of every profile once it has run, 0 before */
+static uint32_t profileFreq[PROFILES_NUMBER];
+
+/* Windows in a row load stayed below the down load */
+static uint32_t lowWindows;
+
+/* Set after a switch, the window of the switch is measured at both clocks so its load is not used */
+static uint8_t switched;
+
+/* This function shall switch to profile, the slowest one is taken back if the switch fails, status_Nok if profile was not applied */
+static status_t GOVERNOR_switchProfile (uint32_t profile)
+{
+	status_t status = status_Ok;
+	uint8_t applied = 1;
+
+	if (RCC_applyProfile(profiles[profile]) == status_Ok)
+	{
+		currentProfile = profile;
+	}
+	else
+	{
+		status = status_Nok;
+		if (RCC_applyProfile(profiles[0]) == status_Ok)
+		{
+			currentProfile = 0;
+		}
+		else
+		{
+			/* Clock RCC fell back to is not a profile, index and frequencies are left as they are */
+			applied = 0;
+		}
+	}
+
+	if (applied)
+	{
+		RCC_getClockFrequency(RCC_FREQ_HCLK, &profileFreq[currentProfile]);
+	}
+
+	lowWindows = 0;
+	switched = 1;
+
+	return status;
+}
+
+/* 
+  Description: This function shall initiate governor and switch to GOVERNOR_INIT_PROFILE,
+               it shall be called after SCHED_init, the slowest profile is taken if it fails.
+               With SCHED_IDLE_BUSY_WAIT it is status_Nok and clock is left as it is
+
+  Input: void
+
+  Output: status_t
+
+ */
+status_t GOVERNOR_init (void)
+{
+	status_t status = status_Ok;
+
+	/* Polling idle loop never sleeps, there is no CPU load to govern clock by */
+	if (GOVERNOR_INIT_PROFILE >= PROFILES_NUMBER || SCHED_IDLE_MODE == SCHED_IDLE_BUSY_WAIT)
+	{
+		return status_Nok;
+	}
+
+	currentProfile = 0;
+	status = GOVERNOR_switchProfile(GOVERNOR_INIT_PROFILE);
+
+	return status;
+}
+
+/* 
+  Description: This function shall switch clock profile from CPU load of the last window,
+               it is the runnable of the scheduler task of the governor
+
+  Input: void
+
+  Output: void
+
+ */
+void GOVERNOR_runnable (void)
+{
+	uint32_t loadPermille;
+	uint32_t slowerFreq;
+
+	if (switched)
+	{
+		switched = 0;
+		return;
+	}
+
+	/* Load is not used before the first window completes */
+	if (SCHED_getCpuLoad(&loadPermille) != status_Ok)
+	{
+		return;
+	}
+
+	if (loadPermille > GOVERNOR_UP_LOAD_PERMILLE)
+	{
+		/* Bursts are served at full speed right away */
+		lowWindows = 0;
+		if (currentProfile != FASTEST_PROFILE)
+		{
+			GOVERNOR_switchProfile(FASTEST_PROFILE);
+		}
+	}
+	else if (loadPermille < GOVERNOR_DOWN_LOAD_PERMILLE)
+	{
+		lowWindows++;
+		if (lowWindows >= GOVERNOR_DOWN_WINDOWS && currentProfile > 0)
+		{
+			/* Slower profile is not taken if the same work would load it above the up load again */
+			slowerFreq = profileFreq[currentProfile - 1];
+			if (slowerFreq == 0 ||
+					(uint64_t)loadPermille * profileFreq[currentProfile] < (uint64_t)GOVERNOR_UP_LOAD_PERMILLE * slowerFreq)
+			{
+				GOVERNOR_switchProfile(currentProfile - 1);
+			}
+		}
+	}
+	else
+	{
+		lowWindows = 0;
+	}
+}
+
+/* 
+  Description: This function shall get the current clock profile
+
+  Input:
+        1- profile -> pointer to hold index of profile in GOVERNOR_PROFILES_LIST
+
+  Output: status_t
+
+ */
+status_t GOVERNOR_getProfile (uint32_t * profile)
+{
+	status_t status = status_Ok;
+
+	if (profile == 0)
+	{
+		status = status_Nok;
+	}
+	else
+	{
+		*profile = currentProfile;
+	}
+
+	return status;
+}
@@ -0,0 +1,58 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: OS                                    */
+/* Component: GOVERNOR                          */
+/* File Name: GOVERNOR.h                        */
+/************************************************/
+
+/*
+  Clock governor driven by CPU load of the scheduler. It switches between the clock profiles
+  of GOVERNOR_PROFILES_LIST, the fastest one as soon as load is high and one profile slower
+  at a time while load stays low. SysTick follows every switch through RCC notifications.
+  GOVERNOR_runnable shall be added to SCHED_TASKS_LIST with a period of one second, the
+  window CPU load is measured over. SCHED_IDLE_BUSY_WAIT measures no load, GOVERNOR_init
+  is then status_Nok and GOVERNOR_runnable leaves the clock as it is
+*/
+
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+
+/* 
+  Description: This function shall initiate governor and switch to GOVERNOR_INIT_PROFILE,
+               it shall be called after SCHED_init, the slowest profile is taken if it fails.
+               With SCHED_IDLE_BUSY_WAIT it is status_Nok and clock is left as it is
+  
+  Input: void
+        
+  Output: status_t
+
+ */
+extern status_t GOVERNOR_init (void);
+
+/* 
+  Description: This function shall switch clock profile from CPU load of the last window,
+               it is the runnable of the scheduler task of the governor
+  
+  Input: void
+        
+  Output: void
+
+ */
+extern void GOVERNOR_runnable (void);
+
+/* 
+  Description: This function shall get the current clock profile
+  
+  Input: 
+        1- profile -> pointer to hold index of profile in GOVERNOR_PROFILES_LIST
+        
+  Output: status_t
+
+ */
+extern status_t GOVERNOR_getProfile (uint32_t * profile);
+
+
+#endif
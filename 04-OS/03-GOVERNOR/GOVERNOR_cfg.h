@@ -0,0 +1,33 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: OS                                    */
+/* Component: GOVERNOR                          */
+/* File Name: GOVERNOR_cfg.h                    */
+/************************************************/
+
+
+#ifndef GOVERNOR_CFG_H
+#define GOVERNOR_CFG_H
+
+/* Clock profiles of RCC_PROFILES_LIST the governor switches between, from the slowest to the fastest */
+#define GOVERNOR_PROFILES_LIST \
+	GOVERNOR_PROFILE(RCC_PROFILE_ID_HSI_8MHZ) \
+	GOVERNOR_PROFILE(RCC_PROFILE_ID_PLL_36MHZ) \
+	GOVERNOR_PROFILE(RCC_PROFILE_ID_PLL_72MHZ)
+
+/* Index in GOVERNOR_PROFILES_LIST of the profile applied by GOVERNOR_init */
+#define GOVERNOR_INIT_PROFILE  0
+
+/* CPU load in permille above which the fastest profile is taken */
+#define GOVERNOR_UP_LOAD_PERMILLE    800
+
+/* CPU load in permille below which the next slower profile is taken, shall be well below the up load */
+#define GOVERNOR_DOWN_LOAD_PERMILLE  300
+
+/* Windows in a row load shall stay below the down load before a slower profile is taken */
+#define GOVERNOR_DOWN_WINDOWS  3
+
+
+#endif
@@ -0,0 +1,612 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: HOST                                  */
+/* Component: SIM                               */
+/* File Name: SIM.c                             */
+/************************************************/
+
+#include "STD_TYPES.h"
+
+#include "SIM.h"
+
+/* Main flash memory of medium density devices */
+#define SIM_FLASH_BASE        0x08000000UL
+#define SIM_FLASH_SIZE        0x00020000UL
+#define SIM_FLASH_PAGE_SIZE   0x00000400UL
+#define SIM_FLASH_ERASED      0xFF
+
+/* Registers word index inside simulated regions */
+#define PERIPH_REG(address)   (((address) - SIM_PERIPH_BASE) / 4)
+#define CORE_REG(address)     (((address) - SIM_CORE_BASE) / 4)
+
+#define RCC_CR                PERIPH_REG(0x40021000UL)
+#define RCC_CFGR              PERIPH_REG(0x40021004UL)
+
+#define FLASH_ACR             PERIPH_REG(0x40022000UL)
+#define FLASH_KEYR            PERIPH_REG(0x40022004UL)
+#define FLASH_SR              PERIPH_REG(0x4002200CUL)
+#define FLASH_CR              PERIPH_REG(0x40022010UL)
+#define FLASH_AR              PERIPH_REG(0x40022014UL)
+
+#define SYSTICK_CTRL          CORE_REG(0xE000E010UL)
+#define SYSTICK_LOAD          CORE_REG(0xE000E014UL)
+#define SYSTICK_VAL           CORE_REG(0xE000E018UL)
+#define SYSTICK_CALIB         CORE_REG(0xE000E01CUL)
+
+#define SCB_ICSR              CORE_REG(0xE000ED04UL)
+
+/* RCC bits */
+#define CR_HSION              0x00000001
+#define CR_HSIRDY             0x00000002
+#define CR_HSEON              0x00010000
+#define CR_HSERDY             0x00020000
+#define CR_PLLON              0x01000000
+#define CR_PLLRDY             0x02000000
+#define CR_RESET_VALUE        0x00000083
+#define CFGR_SW               0x00000003
+#define CFGR_SWS              0x0000000C
+#define CFGR_SWS_POS          2
+
+/* FLASH bits */
+#define FLASH_KEY2            0xCDEF89ABUL
+#define FLASH_ACR_PRFTBE      0x00000010
+#define FLASH_ACR_PRFTBS      0x00000020
+#define FLASH_ACR_RESET_VALUE 0x00000030
+#define FLASH_SR_BSY          0x00000001
+#define FLASH_SR_PGERR        0x00000004
+#define FLASH_SR_WRPRTERR     0x00000010
+#define FLASH_SR_EOP          0x00000020
+/* Flags cleared by writing 1 */
+#define FLASH_SR_W1C          (FLASH_SR_PGERR | FLASH_SR_WRPRTERR | FLASH_SR_EOP)
+/* Reserved bit kept set by the model, a write of SR by a driver clears it */
+#define FLASH_SR_MODEL_MARK   0x80000000
+#define FLASH_CR_PG           0x00000001
+#define FLASH_CR_PER          0x00000002
+#define FLASH_CR_MER          0x00000004
+#define FLASH_CR_STRT         0x00000040
+#define FLASH_CR_LOCK         0x00000080
+
+/* SYSTICK bits */
+#define SYSTICK_ENABLE        0x00000001
+#define SYSTICK_TICKINT       0x00000002
+#define SYSTICK_CLKSOURCE     0x00000004
+#define SYSTICK_COUNTFLAG     0x00010000
+#define SYSTICK_LOAD_MASK     0x00FFFFFF
+#define SYSTICK_CALIB_VALUE   0x00002328
+#define SYSTICK_EXT_DIVIDER   8
+
+/* SCB bits */
+#define ICSR_PENDSTSET        0x04000000
+#define SYSTICK_EXCEPTION     15
+
+/*
+  Cost model in core cycles, these are rough figures from the reference manual
+  and datasheet, good enough to compare two versions of a driver
+*/
+#define COST_WAIT_POLL        4
+#define COST_HSI_STARTUP      16
+#define COST_HSE_STARTUP      16000
+#define COST_PLL_LOCK         1600
+#define COST_FLASH_PROGRAM    3744
+#define COST_FLASH_PAGE_ERASE 1440000
+#define COST_FLASH_MASS_ERASE 2880000
+
+uint32_t SIM_peripheralRegion[SIM_PERIPH_SIZE / 4];
+uint32_t SIM_coreRegion[SIM_CORE_SIZE / 4];
+
+static uint8_t SIM_flashRegion[SIM_FLASH_SIZE];
+
+static uint32_t SIM_coreRegisters[4];
+
+static simCycles_t SIM_cycles;
+static uint32_t SIM_waitPolls;
+static simCycles_t SIM_sleepCycles;
+
+static uint32_t hseStartupRemain;
+static uint32_t pllLockRemain;
+static uint32_t hsiStartupRemain;
+static uint32_t flashBusyRemain;
+/* SR as left by the model, before a driver write */
+static uint32_t flashStatus;
+/* Programmed half word mapped while PG is set, a change of it is a programming error */
+static uint8_t flashCheckPending;
+static uint32_t flashCheckOffset;
+static uint8_t flashCheckValue[2];
+static uint32_t sysTickPrescalerRemain;
+static uint8_t sysTickPending;
+
+/* Cycles left before main loops return, only counted while run is limited */
+static uint8_t runLimited;
+static simCycles_t runRemain;
+
+extern void SysTick_Handler (void);
+
+/* This function shall take SysTick exception, handler runs in handler mode */
+static void SIM_takeSysTick (void)
+{
+	uint32_t ipsr = SIM_coreRegisters[SIM_IPSR];
+
+	SIM_coreRegisters[SIM_IPSR] = SYSTICK_EXCEPTION;
+	SysTick_Handler();
+	SIM_coreRegisters[SIM_IPSR] = ipsr;
+}
+
+/* This function shall hold or release SysTick exception, pending flag is visible in ICSR */
+static void SIM_setSysTickPending (uint8_t pending)
+{
+	sysTickPending = pending;
+
+	if (pending)
+	{
+		SIM_coreRegion[SCB_ICSR] |= ICSR_PENDSTSET;
+	}
+	else
+	{
+		SIM_coreRegion[SCB_ICSR] &= ~ICSR_PENDSTSET;
+	}
+}
+
+
+/* This function shall move an oscillator ready bit after its startup time */
+static void SIM_stepOscillator (uint32_t onBit, uint32_t readyBit, uint32_t startup, uint32_t * remain, uint32_t cycles)
+{
+	uint32_t * CR = &SIM_peripheralRegion[RCC_CR];
+
+	if (!(*CR & onBit))
+	{
+		*CR &= ~readyBit;
+		*remain = startup;
+	}
+	else if (!(*CR & readyBit))
+	{
+		if (*remain > cycles)
+		{
+			*remain -= cycles;
+		}
+		else
+		{
+			*remain = 0;
+			*CR |= readyBit;
+		}
+	}
+}
+
+/* This function shall step RCC model */
+static void SIM_stepRCC (uint32_t cycles)
+{
+	uint32_t * CFGR = &SIM_peripheralRegion[RCC_CFGR];
+	uint32_t readyBit[3] = {CR_HSIRDY, CR_HSERDY, CR_PLLRDY};
+	uint32_t selected;
+
+	SIM_stepOscillator(CR_HSION, CR_HSIRDY, COST_HSI_STARTUP, &hsiStartupRemain, cycles);
+	SIM_stepOscillator(CR_HSEON, CR_HSERDY, COST_HSE_STARTUP, &hseStartupRemain, cycles);
+	SIM_stepOscillator(CR_PLLON, CR_PLLRDY, COST_PLL_LOCK, &pllLockRemain, cycles);
+
+	/* Switch is reflected in SWS only when the selected source is ready */
+	selected = *CFGR & CFGR_SW;
+	if (selected < 3 && (SIM_peripheralRegion[RCC_CR] & readyBit[selected]))
+	{
+		*CFGR = (*CFGR & ~CFGR_SWS) | (selected << CFGR_SWS_POS);
+	}
+}
+
+/* This function shall apply a driver write of FLASH status register, its flags are write 1 to clear */
+static void SIM_syncFlashStatus (void)
+{
+	uint32_t * SR = &SIM_peripheralRegion[FLASH_SR];
+
+	if (!(*SR & FLASH_SR_MODEL_MARK))
+	{
+		*SR = flashStatus & ~(*SR & FLASH_SR_W1C);
+	}
+	*SR |= FLASH_SR_MODEL_MARK;
+	flashStatus = *SR;
+}
+
+/* This function shall step FLASH interface model */
+static void SIM_stepFlash (uint32_t cycles)
+{
+	uint32_t * ACR = &SIM_peripheralRegion[FLASH_ACR];
+	uint32_t * SR = &SIM_peripheralRegion[FLASH_SR];
+	uint32_t * CR = &SIM_peripheralRegion[FLASH_CR];
+	uint32_t index;
+	uint32_t pageStart;
+
+	SIM_syncFlashStatus();
+
+	/* Programming a half word that is not erased fails and leaves it as it was */
+	if (flashCheckPending)
+	{
+		flashCheckPending = 0;
+		if (SIM_flashRegion[flashCheckOffset] != flashCheckValue[0] || SIM_flashRegion[flashCheckOffset + 1] != flashCheckValue[1])
+		{
+			SIM_flashRegion[flashCheckOffset] = flashCheckValue[0];
+			SIM_flashRegion[flashCheckOffset + 1] = flashCheckValue[1];
+			*SR |= FLASH_SR_PGERR;
+		}
+	}
+
+	/* Prefetch buffer status follows its enable bit */
+	if (*ACR & FLASH_ACR_PRFTBE)
+	{
+		*ACR |= FLASH_ACR_PRFTBS;
+	}
+	else
+	{
+		*ACR &= ~FLASH_ACR_PRFTBS;
+	}
+
+	/* Second key written, FPEC unlocked */
+	if (SIM_peripheralRegion[FLASH_KEYR] == FLASH_KEY2)
+	{
+		SIM_peripheralRegion[FLASH_KEYR] = 0;
+		*CR &= ~FLASH_CR_LOCK;
+	}
+
+	if (*CR & FLASH_CR_STRT)
+	{
+		*CR &= ~FLASH_CR_STRT;
+		*SR |= FLASH_SR_BSY;
+
+		if (*CR & FLASH_CR_MER)
+		{
+			for (index = 0; index < SIM_FLASH_SIZE; index++)
+			{
+				SIM_flashRegion[index] = SIM_FLASH_ERASED;
+			}
+			flashBusyRemain = COST_FLASH_MASS_ERASE;
+		}
+		else if (*CR & FLASH_CR_PER)
+		{
+			pageStart = (SIM_peripheralRegion[FLASH_AR] - SIM_FLASH_BASE) & ~(SIM_FLASH_PAGE_SIZE - 1);
+			if (pageStart < SIM_FLASH_SIZE)
+			{
+				for (index = pageStart; index < pageStart + SIM_FLASH_PAGE_SIZE; index++)
+				{
+					SIM_flashRegion[index] = SIM_FLASH_ERASED;
+				}
+			}
+			flashBusyRemain = COST_FLASH_PAGE_ERASE;
+		}
+	}
+
+	if (*SR & FLASH_SR_BSY)
+	{
+		if (flashBusyRemain > cycles)
+		{
+			flashBusyRemain -= cycles;
+		}
+		else
+		{
+			flashBusyRemain = 0;
+			*SR &= ~FLASH_SR_BSY;
+			*SR |= FLASH_SR_EOP;
+		}
+	}
+
+	flashStatus = *SR;
+}
+
+/* This function shall step SYSTICK counter and raise its exception */
+static void SIM_stepSysTick (uint32_t cycles)
+{
+	uint32_t * CTRL = &SIM_coreRegion[SYSTICK_CTRL];
+	uint32_t * VAL = &SIM_coreRegion[SYSTICK_VAL];
+	uint32_t load;
+	uint32_t ticks;
+
+	if (!(*CTRL & SYSTICK_ENABLE))
+	{
+		return;
+	}
+
+	/* Counter clock is AHB or AHB/8 */
+	if (*CTRL & SYSTICK_CLKSOURCE)
+	{
+		ticks = cycles;
+	}
+	else
+	{
+		sysTickPrescalerRemain += cycles;
+		ticks = sysTickPrescalerRemain / SYSTICK_EXT_DIVIDER;
+		sysTickPrescalerRemain %= SYSTICK_EXT_DIVIDER;
+	}
+
+	while (ticks)
+	{
+		load = SIM_coreRegion[SYSTICK_LOAD] & SYSTICK_LOAD_MASK;
+
+		if (*VAL == 0)
+		{
+			/* Counter is stopped when LOAD is zero */
+			if (load == 0)
+			{
+				break;
+			}
+			*VAL = load;
+			ticks--;
+		}
+		else if (*VAL > ticks)
+		{
+			*VAL -= ticks;
+			ticks = 0;
+		}
+		else
+		{
+			ticks -= *VAL;
+			*VAL = 0;
+			*CTRL |= SYSTICK_COUNTFLAG;
+
+			if (*CTRL & SYSTICK_TICKINT)
+			{
+				if (SIM_coreRegisters[SIM_PRIMASK])
+				{
+					SIM_setSysTickPending(1);
+				}
+				else
+				{
+					SIM_takeSysTick();
+				}
+			}
+		}
+	}
+}
+
+/*
+  Description: This function shall reset the register file to the STM32F103 reset values
+               and clear cost counters
+
+  Input: void
+
+  Output: void
+
+ */
+void SIM_init (void)
+{
+	uint32_t index;
+
+	for (index = 0; index < SIM_PERIPH_SIZE / 4; index++)
+	{
+		SIM_peripheralRegion[index] = 0;
+	}
+	for (index = 0; index < SIM_CORE_SIZE / 4; index++)
+	{
+		SIM_coreRegion[index] = 0;
+	}
+	for (index = 0; index < SIM_FLASH_SIZE; index++)
+	{
+		SIM_flashRegion[index] = SIM_FLASH_ERASED;
+	}
+	for (index = 0; index < sizeof(SIM_coreRegisters) / sizeof(SIM_coreRegisters[0]); index++)
+	{
+		SIM_coreRegisters[index] = 0;
+	}
+
+	SIM_peripheralRegion[RCC_CR] = CR_RESET_VALUE;
+	SIM_peripheralRegion[FLASH_ACR] = FLASH_ACR_RESET_VALUE;
+	SIM_peripheralRegion[FLASH_CR] = FLASH_CR_LOCK;
+	SIM_peripheralRegion[FLASH_SR] = FLASH_SR_MODEL_MARK;
+	flashStatus = FLASH_SR_MODEL_MARK;
+	flashCheckPending = 0;
+	SIM_coreRegion[SYSTICK_CALIB] = SYSTICK_CALIB_VALUE;
+
+	hsiStartupRemain = COST_HSI_STARTUP;
+	hseStartupRemain = COST_HSE_STARTUP;
+	pllLockRemain = COST_PLL_LOCK;
+	flashBusyRemain = 0;
+	sysTickPrescalerRemain = 0;
+	SIM_setSysTickPending(0);
+	runLimited = 0;
+
+	SIM_resetCounters();
+}
+
+/*
+  Description: This function shall advance the simulated hardware
+
+  Input:
+        1- cycles -> number of core clock cycles to advance
+
+  Output: void
+
+ */
+void SIM_advance (uint32_t cycles)
+{
+	SIM_cycles += cycles;
+	if (runLimited)
+	{
+		runRemain = (runRemain > cycles) ? runRemain - cycles : 0;
+	}
+
+	SIM_stepRCC(cycles);
+	SIM_stepFlash(cycles);
+	SIM_stepSysTick(cycles);
+}
+
+/* This function shall be the body of every REG_WAIT_WHILE poll */
+void SIM_spin (void)
+{
+	SIM_waitPolls++;
+	SIM_advance(COST_WAIT_POLL);
+}
+
+/* This function shall map a memory bus address to simulated memory, programming FLASH charges its cost */
+void * SIM_mapAddress (uint32_t address)
+{
+	void * mapped = 0;
+	uint32_t offset;
+
+	if (address >= SIM_FLASH_BASE && address < SIM_FLASH_BASE + SIM_FLASH_SIZE)
+	{
+		offset = address - SIM_FLASH_BASE;
+		mapped = &SIM_flashRegion[offset];
+
+		SIM_syncFlashStatus();
+
+		/* Half word about to be programmed, a programmed one is read back or fails to be programmed */
+		if ((SIM_peripheralRegion[FLASH_CR] & FLASH_CR_PG) &&
+				!(SIM_peripheralRegion[FLASH_SR] & FLASH_SR_BSY))
+		{
+			if (SIM_flashRegion[offset] == SIM_FLASH_ERASED && SIM_flashRegion[offset + 1] == SIM_FLASH_ERASED)
+			{
+				SIM_peripheralRegion[FLASH_SR] |= FLASH_SR_BSY;
+				flashStatus = SIM_peripheralRegion[FLASH_SR];
+				flashBusyRemain = COST_FLASH_PROGRAM;
+			}
+			else
+			{
+				flashCheckPending = 1;
+				flashCheckOffset = offset & ~1UL;
+				flashCheckValue[0] = SIM_flashRegion[flashCheckOffset];
+				flashCheckValue[1] = SIM_flashRegion[flashCheckOffset + 1];
+			}
+		}
+	}
+	else if (address >= SIM_PERIPH_BASE && address < SIM_PERIPH_BASE + SIM_PERIPH_SIZE)
+	{
+		mapped = &SIM_peripheralRegion[(address - SIM_PERIPH_BASE) / 4];
+	}
+	else if (address >= SIM_CORE_BASE && address < SIM_CORE_BASE + SIM_CORE_SIZE)
+	{
+		mapped = &SIM_coreRegion[(address - SIM_CORE_BASE) / 4];
+	}
+
+	return mapped;
+}
+
+/* This function shall model WFI, the only simulated interrupt source is SYSTICK */
+void SIM_waitForInterrupt (void)
+{
+	uint32_t * CTRL = &SIM_coreRegion[SYSTICK_CTRL];
+	uint32_t counts;
+	simCycles_t sleepStart = SIM_cycles;
+
+	/* Already pending interrupt, core does not sleep */
+	if (!sysTickPending && (*CTRL & SYSTICK_ENABLE) && (*CTRL & SYSTICK_TICKINT))
+	{
+		/* Counts until the counter reaches zero, a cleared counter reloads first */
+		counts = SIM_coreRegion[SYSTICK_VAL];
+		if (counts == 0)
+		{
+			counts = (SIM_coreRegion[SYSTICK_LOAD] & SYSTICK_LOAD_MASK) + 1;
+		}
+
+		if (*CTRL & SYSTICK_CLKSOURCE)
+		{
+			SIM_advance(counts);
+		}
+		else
+		{
+			SIM_advance(counts * SYSTICK_EXT_DIVIDER - sysTickPrescalerRemain);
+		}
+	}
+
+	SIM_sleepCycles += SIM_cycles - sleepStart;
+}
+
+/* This function shall model MSR to core special registers */
+void SIM_setCoreRegister (uint32_t coreRegister, uint32_t value)
+{
+	SIM_coreRegisters[coreRegister] = value;
+
+	/* Exception held by PRIMASK is taken once it is cleared */
+	if (coreRegister == SIM_PRIMASK && value == 0 && sysTickPending)
+	{
+		SIM_setSysTickPending(0);
+		SIM_takeSysTick();
+	}
+}
+
+/* This function shall model MRS from core special registers */
+uint32_t SIM_getCoreRegister (uint32_t coreRegister)
+{
+	return SIM_coreRegisters[coreRegister];
+}
+
+/*
+  Description: This function shall return the cycles consumed since the last reset,
+               including the cycles charged by every busy wait poll
+
+  Input: void
+
+  Output: number of cycles
+
+ */
+simCycles_t SIM_getCycles (void)
+{
+	return SIM_cycles;
+}
+
+/*
+  Description: This function shall return the number of busy wait polls since the last reset
+
+  Input: void
+
+  Output: number of polls
+
+ */
+uint32_t SIM_getWaitPolls (void)
+{
+	return SIM_waitPolls;
+}
+
+/*
+  Description: This function shall return the cycles spent sleeping in WFI since the last reset
+
+  Input: void
+
+  Output: number of cycles
+
+ */
+simCycles_t SIM_getSleepCycles (void)
+{
+	return SIM_sleepCycles;
+}
+
+/*
+  Description: This function shall clear cycles and polls counters without touching registers
+
+  Input: void
+
+  Output: void
+
+ */
+void SIM_resetCounters (void)
+{
+	SIM_cycles = 0;
+	SIM_waitPolls = 0;
+	SIM_sleepCycles = 0;
+}
+
+/*
+  Description: This function shall let main loops run for the given cycles, the next check
+               of CORE_KEEP_RUNNING after they passed ends the loop and the limit is cleared
+
+  Input:
+        1- cycles -> number of core clock cycles main loops run for
+
+  Output: void
+
+ */
+void SIM_runFor (simCycles_t cycles)
+{
+	runLimited = 1;
+	runRemain = cycles;
+}
+
+/* This function shall be the condition of every main loop, it is 1 forever unless run is limited */
+uint32_t SIM_keepRunning (void)
+{
+	/* A pass of a loop that only polls flags still takes time */
+	SIM_advance(COST_WAIT_POLL);
+
+	if (runLimited && runRemain == 0)
+	{
+		runLimited = 0;
+		return 0;
+	}
+
+	return 1;
+}
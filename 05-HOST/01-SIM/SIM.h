@@ -0,0 +1,100 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: HOST                                  */
+/* Component: SIM                               */
+/* File Name: SIM.h                             */
+/************************************************/
+
+/*
+  Simulated STM32F103 register file used when drivers are built with HOST_SIM.
+  Peripheral blocks are mapped by REG_BLOCK in REG_BACKEND.h, the hardware model
+  (oscillators ready bits, SWS, FLASH busy/erase/programming error, SysTick counter) is stepped by
+  SIM_advance, by every REG_WAIT_WHILE poll and by CORE_WFI which runs until SysTick fires.
+  Side effects of plain register writes become visible on the next simulated cycle.
+  Main loops never end unless SIM_runFor limits them.
+*/
+
+#ifndef SIM_H
+#define SIM_H
+
+typedef unsigned long long simCycles_t;
+
+/*
+  Description: This function shall reset the register file to the STM32F103 reset values
+               and clear cost counters
+
+  Input: void
+
+  Output: void
+
+ */
+extern void SIM_init (void);
+
+/*
+  Description: This function shall advance the simulated hardware
+
+  Input:
+        1- cycles -> number of core clock cycles to advance
+
+  Output: void
+
+ */
+extern void SIM_advance (uint32_t cycles);
+
+/*
+  Description: This function shall return the cycles consumed since the last reset,
+               including the cycles charged by every busy wait poll
+
+  Input: void
+
+  Output: number of cycles
+
+ */
+extern simCycles_t SIM_getCycles (void);
+
+/*
+  Description: This function shall return the number of busy wait polls since the last reset
+
+  Input: void
+
+  Output: number of polls
+
+ */
+extern uint32_t SIM_getWaitPolls (void);
+
+/*
+  Description: This function shall return the cycles spent sleeping in WFI since the last reset
+
+  Input: void
+
+  Output: number of cycles
+
+ */
+extern simCycles_t SIM_getSleepCycles (void);
+
+/*
+  Description: This function shall clear cycles and polls counters without touching registers
+
+  Input: void
+
+  Output: void
+
+ */
+extern void SIM_resetCounters (void);
+
+/*
+  Description: This function shall let main loops run for the given cycles, the next check
+               of CORE_KEEP_RUNNING after they passed ends the loop and the limit is cleared,
+               so host tests can run SCHED_start and get control back
+
+  Input:
+        1- cycles -> number of core clock cycles main loops run for
+
+  Output: void
+
+ */
+extern void SIM_runFor (simCycles_t cycles);
+
+#endif
@@ -0,0 +1,208 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: HOST                                  */
+/* Component: BENCH                             */
+/* File Name: BENCH.c                           */
+/************************************************/
+
+/*
+  Drivers benchmark on the simulated register file.
+  Every line is "<name> <value> <unit>" so CI can diff two runs.
+*/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "STD_TYPES.h"
+#include "SPSC_QUEUE.h"
+
+#include "RCC.h"
+#include "GPIO.h"
+#include "SYSTICK.h"
+#include "FLASH.h"
+
+#include "SIM.h"
+
+#define BENCH_FLASH_PAGE     0x0800FC00
+#define BENCH_FLASH_HALFS    512
+#define BENCH_GPIO_CALLS     1000000
+#define BENCH_SYSTICK_CYCLES 72000000
+#define BENCH_QUEUE_ELEMENTS 4000000
+#define BENCH_QUEUE_CAPACITY 256
+#define BENCH_QUEUE_BATCH    32
+
+static uint32_t sysTickCount;
+
+static uint16_t flashBuffer[BENCH_FLASH_HALFS];
+
+static void BENCH_sysTickCallback (void)
+{
+	sysTickCount++;
+}
+
+static double BENCH_nowNs (void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+static void BENCH_report (const char * name, simCycles_t value, const char * unit)
+{
+	printf("%s %llu %s\n", name, value, unit);
+}
+
+/* 72 MHz bring up from 8 MHz HSE */
+static void BENCH_clockBringUp (void)
+{
+	uint32_t frequency;
+
+	SIM_resetCounters();
+
+	RCC_setClockStatus(SET_HSE_STATUS, STATE_ENABLE);
+	RCC_selectPLL_Source(PLL_SRC_HSE);
+	RCC_setPLL_Multiplication(PLL_MUL_9);
+	RCC_setClockStatus(SET_PLL_STATUS, STATE_ENABLE);
+	RCC_selectSystemClock(SYSTEM_CLOCK_PLL);
+	SIM_advance(1);
+
+	RCC_getSystemFrequency(&frequency);
+
+	BENCH_report("rcc_bringup_cycles", SIM_getCycles(), "cycles");
+	BENCH_report("rcc_bringup_polls", SIM_getWaitPolls(), "polls");
+	BENCH_report("rcc_system_frequency", frequency, "Hz");
+}
+
+/* Erasing and programming one 1 KB page */
+static void BENCH_flashPage (void)
+{
+	uint32_t index;
+	uint32_t failures = 0;
+
+	FLASH_unlock();
+	SIM_advance(1);
+
+	SIM_resetCounters();
+	FLASH_erasePage(BENCH_FLASH_PAGE);
+	BENCH_report("flash_erase_page_cycles", SIM_getCycles(), "cycles");
+
+	SIM_resetCounters();
+	for (index = 0; index < BENCH_FLASH_HALFS; index++)
+	{
+		if (FLASH_programPage(BENCH_FLASH_PAGE + index * 2, (uint16_t)index) != status_Ok)
+		{
+			failures++;
+		}
+	}
+	BENCH_report("flash_program_page_cycles", SIM_getCycles(), "cycles");
+	BENCH_report("flash_program_page_polls", SIM_getWaitPolls(), "polls");
+	BENCH_report("flash_program_page_failures", failures, "halfwords");
+
+	FLASH_erasePage(BENCH_FLASH_PAGE);
+
+	for (index = 0; index < BENCH_FLASH_HALFS; index++)
+	{
+		flashBuffer[index] = (uint16_t)index;
+	}
+
+	SIM_resetCounters();
+	failures = (FLASH_programBuffer(BENCH_FLASH_PAGE, flashBuffer, BENCH_FLASH_HALFS) != status_Ok);
+	BENCH_report("flash_program_buffer_cycles", SIM_getCycles(), "cycles");
+	BENCH_report("flash_program_buffer_polls", SIM_getWaitPolls(), "polls");
+	BENCH_report("flash_program_buffer_failures", failures, "buffers");
+
+	FLASH_lock();
+}
+
+/* One second of 1 ms ticks at 72 MHz */
+static void BENCH_sysTick (void)
+{
+	sysTickCount = 0;
+
+	SYSTICK_init();
+	SYSTICK_setCallback(BENCH_sysTickCallback);
+	SYSTICK_setTimeUs(1000, 72);
+	SYSTICK_start();
+	SIM_advance(BENCH_SYSTICK_CYCLES);
+	SYSTICK_stop();
+
+	BENCH_report("systick_ticks_per_second", sysTickCount, "ticks");
+}
+
+/* Host time of the GPIO write path */
+static void BENCH_gpioWrite (void)
+{
+	uint32_t index;
+	double start;
+	double elapsed;
+
+	start = BENCH_nowNs();
+	for (index = 0; index < BENCH_GPIO_CALLS; index++)
+	{
+		GPIO_directWritePin(PORTA, PIN2, (uint8_t)(index & 1));
+	}
+	elapsed = BENCH_nowNs() - start;
+
+	BENCH_report("gpio_direct_write_host", (simCycles_t)(elapsed * 1000 / BENCH_GPIO_CALLS), "ps/call");
+}
+
+/* Host time per element through a queue of 4 byte elements, one by one then in batches */
+static void BENCH_spscQueue (void)
+{
+	static uint32_t buffer[BENCH_QUEUE_CAPACITY];
+	uint32_t batch[BENCH_QUEUE_BATCH];
+	spscQueue_t queue;
+	uint32_t index;
+	uint32_t element = 0;
+	uint32_t count;
+	uint32_t sum = 0;
+	uint32_t errors = 0;
+	double start;
+	double elapsed;
+
+	SPSC_init(&queue, buffer, sizeof(uint32_t), BENCH_QUEUE_CAPACITY);
+
+	start = BENCH_nowNs();
+	for (index = 0; index < BENCH_QUEUE_ELEMENTS; index++)
+	{
+		SPSC_enqueue(&queue, &index);
+		SPSC_dequeue(&queue, &element);
+		sum += element;
+	}
+	elapsed = BENCH_nowNs() - start;
+	BENCH_report("spsc_single_host", (simCycles_t)(elapsed * 1000 / BENCH_QUEUE_ELEMENTS), "ps/element");
+
+	start = BENCH_nowNs();
+	for (index = 0; index < BENCH_QUEUE_ELEMENTS; index += BENCH_QUEUE_BATCH)
+	{
+		for (count = 0; count < BENCH_QUEUE_BATCH; count++)
+		{
+			batch[count] = index + count;
+		}
+		SPSC_enqueueBatch(&queue, batch, BENCH_QUEUE_BATCH, &count);
+		SPSC_dequeueBatch(&queue, batch, BENCH_QUEUE_BATCH, &count);
+		/* Elements come out in order, also across the wrap of the buffer */
+		if (batch[0] != index || batch[BENCH_QUEUE_BATCH - 1] != index + BENCH_QUEUE_BATCH - 1)
+		{
+			errors++;
+		}
+	}
+	elapsed = BENCH_nowNs() - start;
+	BENCH_report("spsc_batch_host", (simCycles_t)(elapsed * 1000 / BENCH_QUEUE_ELEMENTS), "ps/element");
+	BENCH_report("spsc_errors", errors + (sum != (uint32_t)((BENCH_QUEUE_ELEMENTS - 1ULL) * BENCH_QUEUE_ELEMENTS / 2)), "errors");
+}
+
+int main (void)
+{
+	SIM_init();
+
+	BENCH_clockBringUp();
+	BENCH_flashPage();
+	BENCH_sysTick();
+	BENCH_gpioWrite();
+	BENCH_spscQueue();
+
+	return 0;
+}
@@ -0,0 +1,268 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: HOST                                  */
+/* Component: ANALYZER                          */
+/* File Name: ANALYZER.c                        */
+/************************************************/
+
+/*
+  Offline schedulability analysis of the task table configured in SCHEDULER_cfg.h.
+  The table is the one built by SCHEDULER_cfg.c for the firmware, offsets are the ones
+  SCHED_init would use and execution times are execUs of SCHED_TASKS_LIST.
+  Every line is "<name> <value> <unit>", exit status is not zero if a deadline is missed
+  so the host build fails. Utilization above 1000 permille fails before the schedule is
+  analyzed, response times of an overloaded table grow without bound.
+
+  Deadline of every task is deadlineUs of SCHED_TASKS_LIST, its period when not set.
+  1- SCHED_MODE_COOPERATIVE -> tasks run to completion in release order, tasks due at the
+                               same tick in table order, worst response time is found by
+                               running the schedule over the hyperperiod after the last offset
+                               (SCHED_CATCHUP_RUN_ALL, the other policies drop late releases)
+  2- SCHED_MODE_PREEMPTIVE  -> fixed priority response time analysis, tasks of equal
+                               priority interfere with each other as they do not preempt
+  Event tasks (periodUs 0) have no minimum time between activations in the table, so they
+  are reported but left out of the analysis, their load shall be kept in the margin
+*/
+
+#include <stdio.h>
+
+#include "STD_TYPES.h"
+
+#include "SCHEDULER.h"
+#include "SCHEDULER_cfg.h"
+
+#include "SIM.h"
+
+/* Schedule simulation is cut after this number of ticks for very long hyperperiods */
+#define ANALYZER_MAX_SIM_TICKS  1000000ULL
+
+typedef unsigned long long analyzerTime_t;
+
+/* Runnables are only referenced by the table, they are never called here */
+#define SCHED_TASK(name, runnable, periodUs, offsetUs, priority, execUs, deadlineUs) \
+	void runnable (void) {}
+SCHED_TASKS_LIST
+#undef SCHED_TASK
+
+#define SCHED_TASK(name, runnable, periodUs, offsetUs, priority, execUs, deadlineUs) #name,
+static const char * taskNames[MAX_TASKS_NUMBER] = {
+		SCHED_TASKS_LIST
+};
+#undef SCHED_TASK
+
+static const sysTasksInfo_t * sysTasksInfo;
+
+static uint32_t offsets[MAX_TASKS_NUMBER];
+
+static analyzerTime_t responseUs[MAX_TASKS_NUMBER];
+
+static void ANALYZER_report (const char * name, analyzerTime_t value, const char * unit)
+{
+	printf("%s %llu %s\n", name, value, unit);
+}
+
+static void ANALYZER_reportTask (uint32_t task, const char * name, analyzerTime_t value, const char * unit)
+{
+	printf("sched_task_%s_%s %llu %s\n", taskNames[task], name, value, unit);
+}
+
+/* Least common multiple of tasks' periods in ticks */
+static analyzerTime_t ANALYZER_getHyperperiod (void)
+{
+	analyzerTime_t hyperperiod = 1;
+	analyzerTime_t a;
+	analyzerTime_t b;
+	analyzerTime_t remainder;
+	uint32_t task;
+
+	for (task = 0; task < MAX_TASKS_NUMBER; task++)
+	{
+		if (sysTasksInfo[task].periodTicks == 0)
+		{
+			continue;
+		}
+
+		a = hyperperiod;
+		b = sysTasksInfo[task].periodTicks;
+		while (b)
+		{
+			remainder = a % b;
+			a = b;
+			b = remainder;
+		}
+		hyperperiod = (hyperperiod / a) * sysTasksInfo[task].periodTicks;
+	}
+
+	return hyperperiod;
+}
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+/* Worst response time of every task by running the cooperative schedule tick by tick */
+static void ANALYZER_runCooperative (analyzerTime_t hyperperiod)
+{
+	analyzerTime_t simTicks;
+	analyzerTime_t tick;
+	analyzerTime_t releaseUs;
+	analyzerTime_t busyUntilUs = 0;
+	analyzerTime_t startUs;
+	uint32_t maxOffset = 0;
+	uint32_t task;
+
+	for (task = 0; task < MAX_TASKS_NUMBER; task++)
+	{
+		if (offsets[task] > maxOffset)
+		{
+			maxOffset = offsets[task];
+		}
+	}
+
+	/* Backlog left from the first hyperperiod shows in the second one */
+	simTicks = maxOffset + 2 * hyperperiod;
+	if (simTicks > ANALYZER_MAX_SIM_TICKS)
+	{
+		simTicks = ANALYZER_MAX_SIM_TICKS;
+	}
+	ANALYZER_report("sched_simulated_ticks", simTicks, "ticks");
+
+	for (tick = 0; tick < simTicks; tick++)
+	{
+		releaseUs = tick * TICK_USEC;
+
+		for (task = 0; task < MAX_TASKS_NUMBER; task++)
+		{
+			if (sysTasksInfo[task].periodTicks != 0 &&
+					tick >= offsets[task] && (tick - offsets[task]) % sysTasksInfo[task].periodTicks == 0)
+			{
+				startUs = (busyUntilUs > releaseUs) ? busyUntilUs : releaseUs;
+				busyUntilUs = startUs + sysTasksInfo[task].execUs;
+
+				if (busyUntilUs - releaseUs > responseUs[task])
+				{
+					responseUs[task] = busyUntilUs - releaseUs;
+				}
+			}
+		}
+	}
+}
+#else
+/* Worst response time of every task by fixed priority response time analysis */
+static void ANALYZER_runPreemptive (void)
+{
+	analyzerTime_t response;
+	analyzerTime_t nextResponse;
+	analyzerTime_t periodUs;
+	uint32_t task;
+	uint32_t other;
+
+	for (task = 0; task < MAX_TASKS_NUMBER; task++)
+	{
+		if (sysTasksInfo[task].periodTicks == 0)
+		{
+			continue;
+		}
+
+		nextResponse = sysTasksInfo[task].execUs;
+
+		/* Iterating until response converges or passes the deadline */
+		do
+		{
+			response = nextResponse;
+			nextResponse = sysTasksInfo[task].execUs;
+
+			for (other = 0; other < MAX_TASKS_NUMBER; other++)
+			{
+				if (other != task && sysTasksInfo[other].periodTicks != 0 &&
+						sysTasksInfo[other].priority <= sysTasksInfo[task].priority)
+				{
+					periodUs = (analyzerTime_t)sysTasksInfo[other].periodTicks * TICK_USEC;
+					nextResponse += ((response + periodUs - 1) / periodUs) * sysTasksInfo[other].execUs;
+				}
+			}
+		}
+		while (nextResponse != response && nextResponse <= (analyzerTime_t)sysTasksInfo[task].deadlineTicks * TICK_USEC);
+
+		responseUs[task] = nextResponse;
+	}
+}
+#endif
+
+int main (void)
+{
+	analyzerTime_t hyperperiod;
+	analyzerTime_t utilization;
+	analyzerTime_t loadPpm = 0;
+	analyzerTime_t deadlineUs;
+	uint32_t worstTickLoadUs;
+	uint32_t missed = 0;
+	uint32_t events = 0;
+	uint32_t task;
+
+	SIM_init();
+
+	sysTasksInfo = getSysTasksInfo();
+	SCHED_getTaskOffsets(offsets);
+	SCHED_getWorstTickLoad(&worstTickLoadUs);
+
+	hyperperiod = ANALYZER_getHyperperiod();
+
+	for (task = 0; task < MAX_TASKS_NUMBER; task++)
+	{
+		if (sysTasksInfo[task].periodTicks == 0)
+		{
+			events++;
+			continue;
+		}
+
+		/* Summed in ppm so rounding of every task does not hide an overload */
+		loadPpm += ((analyzerTime_t)sysTasksInfo[task].execUs * 1000000) / ((analyzerTime_t)sysTasksInfo[task].periodTicks * TICK_USEC);
+	}
+	utilization = loadPpm / 1000;
+
+	ANALYZER_report("sched_tasks", MAX_TASKS_NUMBER, "tasks");
+	ANALYZER_report("sched_tick", TICK_USEC, "us");
+	ANALYZER_report("sched_event_tasks", events, "tasks");
+	ANALYZER_report("sched_hyperperiod", hyperperiod, "ticks");
+	ANALYZER_report("sched_utilization", utilization, "permille");
+	ANALYZER_report("sched_worst_tick_load", worstTickLoadUs, "us");
+	ANALYZER_report("sched_worst_tick_utilization", ((analyzerTime_t)worstTickLoadUs * 1000) / TICK_USEC, "permille");
+
+	if (loadPpm > 1000000)
+	{
+		fprintf(stderr, "error: utilization %llu ppm is above 1000000 ppm, task table can not be scheduled\n", loadPpm);
+		return 1;
+	}
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	ANALYZER_runCooperative(hyperperiod);
+#else
+	ANALYZER_runPreemptive();
+#endif
+
+	for (task = 0; task < MAX_TASKS_NUMBER; task++)
+	{
+		if (sysTasksInfo[task].periodTicks == 0)
+		{
+			ANALYZER_reportTask(task, "event", 1, "bool");
+			continue;
+		}
+
+		deadlineUs = (analyzerTime_t)sysTasksInfo[task].deadlineTicks * TICK_USEC;
+
+		ANALYZER_reportTask(task, "offset", offsets[task], "ticks");
+		ANALYZER_reportTask(task, "wcrt", responseUs[task], "us");
+		ANALYZER_reportTask(task, "deadline", deadlineUs, "us");
+
+		if (responseUs[task] > deadlineUs)
+		{
+			missed++;
+			fprintf(stderr, "error: task %s misses its deadline, response %llu us > deadline %llu us\n",
+					taskNames[task], responseUs[task], deadlineUs);
+		}
+	}
+
+	ANALYZER_report("sched_deadline_misses", missed, "tasks");
+
+	return missed ? 1 : 0;
+}
@@ -0,0 +1,725 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: HOST                                  */
+/* Component: TEST                              */
+/* File Name: SCHED_TEST.c                      */
+/************************************************/
+
+/*
+  White box tests of the scheduler on the configurations of SCHED_TEST_cfg.h, SCHEDULER.c is
+  included so its state can be checked and the tick handler driven directly. Every variant
+  runs the tests its configuration has, output and exit status follow TEST.c.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "SCHEDULER.c"
+
+#include "SIM.h"
+
+/* Scheduler tick at HSI and runs recorded by a test */
+#define TEST_HSI_MHZ         8
+#define TEST_TICK_CYCLES     ((simCycles_t)TICK_USEC * TEST_HSI_MHZ)
+#define TEST_LOG_SIZE        256
+#define TEST_STEP_CYCLES     100
+
+/* Runs when A activates E at tick 1, B is placed at tick 2 with automatic offsets */
+#if SCHED_OFFSETS_MODE == SCHED_OFFSETS_TABLE
+#define TEST_EVENT_LOG       "1ABE3A"
+#else
+#define TEST_EVENT_LOG       "1AE2B3A"
+#endif
+
+/* Runs after the first run of A overruns ticks 2 to 5, A is due at odd ticks and B every 3 ticks */
+#if SCHED_CATCHUP_POLICY == SCHED_CATCHUP_RUN_ALL
+#define TEST_CATCHUP_LOG     "1A5BABA7AB"
+#elif SCHED_CATCHUP_POLICY == SCHED_CATCHUP_SKIP
+#define TEST_CATCHUP_LOG     "1A5BA7AB"
+#else
+#define TEST_CATCHUP_LOG     "1A5BAB7AB"
+#endif
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+/* Set bit of PendSV pending in ICSR, cleared when the exception is taken */
+#define TEST_ICSR            ((volatile uint32_t *)REG_BLOCK(0xE000ED04UL))
+#define TEST_ICSR_PENDSVSET  0x10000000
+
+#define TEST_READY_A         0x1
+#define TEST_READY_B         0x2
+#define TEST_READY_E         0x4
+#endif
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+/* RCC CSR holding reset flags, set by hand as the simulator has no watchdog reset */
+#define TEST_RCC_CSR         ((volatile uint32_t *)REG_BLOCK(0x40021024UL))
+#endif
+
+static uint32_t checks;
+static uint32_t failures;
+
+static char runLog[TEST_LOG_SIZE];
+static uint32_t runLogLength;
+static uint32_t runLogTick;
+static void (*taskAAction)(void);
+static void (*taskBAction)(void);
+static void (*taskEAction)(void);
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+static uint32_t waitTicks;
+static uint32_t readyWhileWaiting;
+static uint8_t preemptedByB;
+#endif
+
+static void TEST_report (const char * name, uint32_t value, const char * unit)
+{
+	printf("%s %u %s\n", name, value, unit);
+}
+
+static void TEST_check (uint32_t condition, const char * test, const char * check)
+{
+	checks++;
+	if (!condition)
+	{
+		failures++;
+		fprintf(stderr, "error: %s: %s: %s\n", SCHED_TEST_NAME, test, check);
+	}
+}
+
+/* Runs of the scheduler, every run adds its task letter and a tick number when the tick changes */
+static void TEST_logRun (char task)
+{
+	uint64_t nowUs;
+	uint32_t tick;
+
+	SCHED_getTimestampUs(&nowUs);
+	tick = (uint32_t)(nowUs / TICK_USEC);
+
+	if (tick != runLogTick && runLogLength < TEST_LOG_SIZE)
+	{
+		runLogLength += snprintf(&runLog[runLogLength], TEST_LOG_SIZE - runLogLength, "%u", tick);
+		runLogTick = tick;
+	}
+	if (runLogLength < TEST_LOG_SIZE - 1)
+	{
+		runLog[runLogLength++] = task;
+		runLog[runLogLength] = 0;
+	}
+}
+
+/* Runnables of the task table */
+void TEST_taskA (void)
+{
+	TEST_logRun('A');
+	if (taskAAction)
+	{
+		taskAAction();
+	}
+}
+
+void TEST_taskB (void)
+{
+	TEST_logRun('B');
+	if (taskBAction)
+	{
+		taskBAction();
+	}
+}
+
+void TEST_taskE (void)
+{
+	TEST_logRun('E');
+	if (taskEAction)
+	{
+		taskEAction();
+	}
+}
+
+/* Scheduler is initialized on HSI with an empty run log */
+static void TEST_schedSetUp (void)
+{
+	SIM_init();
+	SCHED_init();
+
+	runLog[0] = 0;
+	runLogLength = 0;
+	runLogTick = 0;
+	taskAAction = 0;
+	taskBAction = 0;
+	taskEAction = 0;
+}
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+/* Scheduler runs the given ticks, the one after them is raised but not processed */
+static void TEST_schedRun (uint32_t ticks)
+{
+	SIM_runFor(ticks * TEST_TICK_CYCLES + TEST_TICK_CYCLES / 2);
+	SCHED_start();
+}
+#endif
+
+/* Table of SCHEDULER_cfg.c is in ticks, a task without deadline has its period */
+static void TEST_taskTable (void)
+{
+	const sysTasksInfo_t * info = getSysTasksInfo();
+
+	TEST_check(info[SCHED_TASK_ID_taskA].periodTicks == 2 && info[SCHED_TASK_ID_taskA].delayTicks == 0 &&
+			info[SCHED_TASK_ID_taskA].deadlineTicks == 2, "task_table", "period and offset in ticks");
+	TEST_check(info[SCHED_TASK_ID_taskB].periodTicks == SCHED_TEST_PERIOD_B && info[SCHED_TASK_ID_taskB].deadlineTicks == 2,
+			"task_table", "deadline in ticks");
+	TEST_check(info[SCHED_TASK_ID_taskE].periodTicks == 0 && info[SCHED_TASK_ID_taskE].execUs == 100,
+			"task_table", "event task kept without period");
+}
+
+#if SCHED_OFFSETS_MODE == SCHED_OFFSETS_TABLE
+/* Table offsets are taken as they are, worst tick load sums tasks released together */
+static void TEST_taskOffsets (void)
+{
+	uint32_t offsets[MAX_TASKS_NUMBER];
+	uint32_t loadUs;
+
+	TEST_schedSetUp();
+	TEST_check(SCHED_getTaskOffsets(offsets) == status_Ok && offsets[SCHED_TASK_ID_taskA] == 0 &&
+			offsets[SCHED_TASK_ID_taskB] == 0, "task_offsets", "table offsets kept");
+	TEST_check(SCHED_getWorstTickLoad(&loadUs) == status_Ok && loadUs == 200, "task_offsets", "worst tick load");
+}
+#else
+/* B every 4 ticks is placed between releases of A, so no tick releases both */
+static void TEST_taskOffsets (void)
+{
+	uint32_t offsets[MAX_TASKS_NUMBER];
+	uint32_t loadUs;
+
+	TEST_schedSetUp();
+	TEST_check(SCHED_getTaskOffsets(offsets) == status_Ok && offsets[SCHED_TASK_ID_taskA] == 0 &&
+			offsets[SCHED_TASK_ID_taskB] == 1, "task_offsets", "tasks placed apart");
+	TEST_check(SCHED_getWorstTickLoad(&loadUs) == status_Ok && loadUs == 100, "task_offsets", "worst tick load flattened");
+
+	TEST_schedRun(7);
+	TEST_check(strcmp(runLog, "1A2B3A5A6B7A") == 0, "task_offsets", "tasks released at their offsets");
+}
+#endif
+
+/* Time base counts past 2^32 ticks without going back, a tick held pending is counted too */
+static void TEST_timeBaseWrap (void)
+{
+	uint64_t previousUs = 0;
+	uint64_t nowUs;
+	uint32_t backSteps = 0;
+	uint32_t local_stepLoop;
+
+	TEST_schedSetUp();
+	tickCount = 0xFFFFFFFE;
+	timeBaseRunning = 1;
+	SYSTICK_start();
+
+	for (local_stepLoop = 0; local_stepLoop < 3 * TEST_TICK_CYCLES / TEST_STEP_CYCLES; local_stepLoop++)
+	{
+		SIM_advance(TEST_STEP_CYCLES);
+		SCHED_getTimestampUs(&nowUs);
+		if (nowUs < previousUs)
+		{
+			backSteps++;
+		}
+		previousUs = nowUs;
+	}
+	TEST_check(backSteps == 0, "time_base_wrap", "timestamp monotonic across the wrap");
+	TEST_check(tickCountHigh == 1 && nowUs >= (0x100000000ULL + 1) * TICK_USEC, "time_base_wrap", "high word of tick count carried");
+
+	/* Tick that wraps the count is held pending */
+	TEST_schedSetUp();
+	tickCount = 0xFFFFFFFF;
+	timeBaseRunning = 1;
+	SYSTICK_start();
+
+	CORE_SET_PRIMASK(1);
+	SIM_advance(TEST_TICK_CYCLES + TEST_TICK_CYCLES / 2);
+	SCHED_getTimestampUs(&nowUs);
+	TEST_check(tickCount == 0xFFFFFFFF && nowUs >= 0x100000000ULL * TICK_USEC && nowUs < (0x100000000ULL + 1) * TICK_USEC,
+			"time_base_wrap", "pending tick counted past the wrap");
+	CORE_SET_PRIMASK(0);
+	SIM_advance(TEST_STEP_CYCLES);
+	SCHED_getTimestampUs(&previousUs);
+	TEST_check(tickCountHigh == 1 && previousUs >= nowUs, "time_base_wrap", "time base kept once tick is taken");
+}
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+/* Two activations before E is dispatched make one run */
+static void TEST_activateTwice (void)
+{
+	taskAAction = 0;
+	SCHED_activateTask(SCHED_TASK_ID_taskE);
+	SCHED_activateTask(SCHED_TASK_ID_taskE);
+}
+
+/* Event task runs once after the periodic tasks of the tick it was activated in */
+static void TEST_eventTask (void)
+{
+	TEST_schedSetUp();
+	TEST_check(SCHED_activateTask(SCHED_TASK_ID_taskA) == status_Nok, "event_task", "periodic task not activated");
+	TEST_check(SCHED_activateTask(SCHED_TASKS_POOL_SIZE) == status_Nok, "event_task", "task out of pool refused");
+
+	taskAAction = TEST_activateTwice;
+	TEST_schedRun(3);
+	TEST_check(strcmp(runLog, TEST_EVENT_LOG) == 0, "event_task", "event dispatched once after periodic tasks");
+}
+#endif
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+/* Runs of A left to overrun and runs of E made while A still overruns */
+static uint32_t overrunsLeft;
+static uint32_t eventsInOverload;
+
+/* Run of A is busy for half a tick */
+static void TEST_busyHalfTick (void)
+{
+	SIM_advance(TEST_TICK_CYCLES / 2);
+}
+
+/* Load is the part of a one second window core did not sleep, it is not known before the first window */
+static void TEST_cpuLoad (void)
+{
+	uint32_t loadPermille = 0;
+
+	TEST_schedSetUp();
+	taskAAction = TEST_busyHalfTick;
+
+	TEST_schedRun(LOAD_WINDOW_TICKS - 1);
+	TEST_check(SCHED_getCpuLoad(&loadPermille) == status_Nok, "cpu_load", "load unknown before the first window");
+
+	TEST_schedSetUp();
+	taskAAction = TEST_busyHalfTick;
+
+	TEST_schedRun(LOAD_WINDOW_TICKS);
+	TEST_check(SCHED_getCpuLoad(&loadPermille) == status_Ok, "cpu_load", "load measured after the first window");
+	TEST_check(loadPermille >= 240 && loadPermille <= 260, "cpu_load", "half a tick every 2 ticks is a quarter");
+}
+
+/* Statuses and time taken by delays made in a run of A */
+static status_t shortDelayStatus;
+static status_t longDelayStatus;
+static simCycles_t shortDelayCycles;
+static simCycles_t longDelayCycles;
+
+/* A delay within the tick is waited, one past it returns at once */
+static void TEST_delayInRun (void)
+{
+	simCycles_t startCycles;
+
+	taskAAction = 0;
+
+	startCycles = SIM_getCycles();
+	shortDelayStatus = SCHED_delayUs(TICK_USEC / 10);
+	shortDelayCycles = SIM_getCycles() - startCycles;
+
+	startCycles = SIM_getCycles();
+	longDelayStatus = SCHED_delayUs(2 * TICK_USEC);
+	longDelayCycles = SIM_getCycles() - startCycles;
+}
+
+/* Delay in a cooperative task never holds the next tick */
+static void TEST_delayPending (void)
+{
+	TEST_schedSetUp();
+	taskAAction = TEST_delayInRun;
+	TEST_schedRun(1);
+
+	TEST_check(shortDelayStatus == status_Ok && shortDelayCycles >= TEST_TICK_CYCLES / 10 &&
+			shortDelayCycles < TEST_TICK_CYCLES / 5, "delay_pending", "delay within the tick waited");
+	TEST_check(longDelayStatus == status_Pending && longDelayCycles < TEST_TICK_CYCLES / 10, "delay_pending", "delay past the tick pending");
+}
+
+/* Run of A activates E and overruns its period */
+static void TEST_overload (void)
+{
+	if (overrunsLeft)
+	{
+		overrunsLeft--;
+		SCHED_activateTask(SCHED_TASK_ID_taskE);
+		SIM_advance(5 * TEST_TICK_CYCLES / 2);
+	}
+}
+
+static void TEST_countEventInOverload (void)
+{
+	if (overrunsLeft)
+	{
+		eventsInOverload++;
+	}
+}
+
+/* Event task still runs while periodic tasks leave a tick pending after every batch */
+static void TEST_eventInOverload (void)
+{
+	TEST_schedSetUp();
+	overrunsLeft = 4;
+	eventsInOverload = 0;
+	taskAAction = TEST_overload;
+	taskEAction = TEST_countEventInOverload;
+
+	TEST_schedRun(16);
+	TEST_check(eventsInOverload >= 1, "event_in_overload", "event not starved by overrunning task");
+}
+#endif
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE && SCHED_OFFSETS_MODE == SCHED_OFFSETS_TABLE
+/* Dynamic tasks C and D of TEST_taskPool */
+static uint32_t taskC;
+static uint32_t taskD;
+
+static void TEST_taskC (void)
+{
+	TEST_logRun('C');
+}
+
+static void TEST_taskD (void)
+{
+	TEST_logRun('D');
+}
+
+/* Run of A at tick 3 resumes B, it is due at the next tick */
+static void TEST_resumeB (void)
+{
+	taskAAction = 0;
+	TEST_check(SCHED_resumeTask(SCHED_TASK_ID_taskB) == status_Ok, "task_pool", "task resumed");
+	TEST_check(SCHED_resumeTask(SCHED_TASK_ID_taskB) == status_Nok, "task_pool", "active task not resumed");
+}
+
+/* Run of A at tick 1 changes tasks due after it in the same tick */
+static void TEST_changeTasks (void)
+{
+	taskAAction = TEST_resumeB;
+	TEST_check(SCHED_suspendTask(SCHED_TASK_ID_taskB) == status_Ok, "task_pool", "task suspended");
+	TEST_check(SCHED_deleteTask(taskD) == status_Ok, "task_pool", "task deleted");
+	TEST_check(SCHED_setTaskPeriod(taskC, 2 * TICK_USEC) == status_Ok, "task_pool", "period changed");
+}
+
+/* Tasks are created in free slots, changed tasks due in the same tick follow the change */
+static void TEST_taskPool (void)
+{
+	uint32_t taskIndex;
+
+	TEST_schedSetUp();
+	TEST_check(SCHED_createTask(TEST_taskC, TICK_USEC, 0, 0, &taskC) == status_Ok &&
+			SCHED_createTask(TEST_taskD, TICK_USEC, 0, 0, &taskD) == status_Ok, "task_pool", "tasks created");
+	TEST_check(SCHED_createTask(TEST_taskC, TICK_USEC, 0, 0, &taskIndex) == status_Nok, "task_pool", "full pool refused");
+	TEST_check(SCHED_createTask(TEST_taskC, TICK_USEC / 2, 0, 0, &taskIndex) == status_Nok, "task_pool", "part of a tick refused");
+	TEST_check(SCHED_deleteTask(SCHED_TASK_ID_taskA) == status_Nok, "task_pool", "table task not deleted");
+	TEST_check(SCHED_setTaskPeriod(SCHED_TASK_ID_taskE, TICK_USEC) == status_Nok, "task_pool", "event task kept without period");
+
+	taskAAction = TEST_changeTasks;
+	TEST_schedRun(7);
+	TEST_check(strcmp(runLog, "1AC3AC4B5AC7ABC") == 0, "task_pool", "changes applied in order");
+
+	TEST_check(SCHED_createTask(TEST_taskD, TICK_USEC, 0, 0, &taskIndex) == status_Ok && taskIndex == taskD,
+			"task_pool", "deleted slot reused");
+}
+
+/* First run of A lasts into tick 5 */
+static void TEST_overrunOnce (void)
+{
+	taskAAction = 0;
+	SIM_advance(4 * TEST_TICK_CYCLES);
+}
+
+/* Releases missed by an overrun are run, dropped or merged by the catch up policy */
+static void TEST_catchUp (void)
+{
+	uint32_t overruns;
+
+	TEST_schedSetUp();
+	taskAAction = TEST_overrunOnce;
+	TEST_schedRun(8);
+
+	TEST_check(SCHED_getTickOverruns(&overruns) == status_Ok && overruns == 3, "catch_up", "ticks raised during the run counted");
+	TEST_check(strcmp(runLog, TEST_CATCHUP_LOG) == 0, "catch_up", "missed releases handled by the policy");
+}
+#endif
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+/* Task saved by the supervisor is reported after a watchdog reset only */
+static void TEST_resetTask (const char * test)
+{
+	uint16_t savedTask = 0;
+	uint32_t taskIndex = SCHED_TASKS_POOL_SIZE;
+
+	BKP_read(SCHED_RESET_BKP_REGISTER, &savedTask);
+	TEST_check(supervisorTripped && savedTask == (RESET_MARKER | SCHED_TASK_ID_taskA), test, "stuck task saved");
+
+	/* Watchdog reset, backup domain is kept */
+	*TEST_RCC_CSR |= RESET_FLAG_IWDG;
+	SCHED_init();
+	TEST_check(SCHED_getResetTask(&taskIndex) == status_Ok && taskIndex == SCHED_TASK_ID_taskA, test, "stuck task reported");
+
+	/* Any other reset leaves a saved task unreported */
+	BKP_write(SCHED_RESET_BKP_REGISTER, RESET_MARKER | SCHED_TASK_ID_taskB);
+	*TEST_RCC_CSR &= ~RESET_FLAG_IWDG;
+	SCHED_init();
+	TEST_check(SCHED_getResetTask(&taskIndex) == status_Nok, test, "task of other reset not reported");
+}
+#endif
+
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE && SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+/* First run of A lasts 2 ticks and a half, past its deadline and the one of B after it */
+static void TEST_overrunDeadlines (void)
+{
+	taskAAction = 0;
+	SIM_advance(5 * TEST_TICK_CYCLES / 2);
+}
+
+/* Run of A never returns within the hang timeout */
+static void TEST_hang (void)
+{
+	taskAAction = 0;
+	SIM_advance((HANG_TICKS + 1) * TEST_TICK_CYCLES);
+}
+
+/* A late run counts one miss for its release, a stuck run trips the supervisor */
+static void TEST_supervision (void)
+{
+	uint32_t misses[MAX_TASKS_NUMBER] = {0};
+	uint32_t local_taskLoop;
+
+	TEST_schedSetUp();
+	taskAAction = TEST_overrunDeadlines;
+	TEST_schedRun(6);
+
+	for (local_taskLoop = 0; local_taskLoop < MAX_TASKS_NUMBER; local_taskLoop++)
+	{
+		SCHED_getDeadlineMisses(local_taskLoop, &misses[local_taskLoop]);
+	}
+	TEST_check(misses[SCHED_TASK_ID_taskA] == 1 && misses[SCHED_TASK_ID_taskB] == 1 && misses[SCHED_TASK_ID_taskE] == 0,
+			"supervision", "missed deadlines counted");
+	TEST_check(!supervisorTripped, "supervision", "late run not stuck");
+
+	TEST_schedSetUp();
+	taskAAction = TEST_hang;
+	TEST_schedRun(HANG_TICKS + 3);
+	TEST_resetTask("supervision");
+}
+#endif
+
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+/* Scheduler is started as SCHED_start does, without switching to the first task */
+static void TEST_preemptiveStart (void)
+{
+	TEST_schedSetUp();
+	timeBaseRunning = 1;
+	SYSTICK_start();
+}
+
+/* Simulated time runs up to the next SysTick exception */
+static void TEST_tick (void)
+{
+	uint32_t count = tickCount;
+
+	while (tickCount == count)
+	{
+		SIM_advance(TEST_STEP_CYCLES);
+	}
+}
+
+/* PendSV is taken if it is pending, it selects the next task as the handler does */
+static uint8_t TEST_takePendSV (void)
+{
+	uint8_t pending;
+
+	NVIC_getSystemPending(SYS_HANDLER_PENDSV, &pending);
+	if (pending)
+	{
+		*TEST_ICSR &= ~TEST_ICSR_PENDSVSET;
+		SCHED_switchContext(currentTask->stackPointer);
+	}
+
+	return pending;
+}
+
+/* Ticks 2 and 3 come while A runs, A is released again at tick 3 */
+static void TEST_tickTwice (void)
+{
+	TEST_tick();
+	TEST_tick();
+}
+
+/* Ticks up to 7 come while A runs, B is released at tick 7 with a higher priority */
+static void TEST_tickToB (void)
+{
+	uint8_t pending;
+
+	while (tickCount < 7)
+	{
+		TEST_tick();
+	}
+	NVIC_getSystemPending(SYS_HANDLER_PENDSV, &pending);
+	preemptedByB = pending && SCHED_getHighestReady() == &sysTasks[SCHED_TASK_ID_taskB];
+}
+
+/* Ready tasks are picked by priority from the bitmap, a release during a run keeps its task ready */
+static void TEST_preemptiveReady (void)
+{
+	TEST_preemptiveStart();
+
+	TEST_tick();
+	TEST_check(readyTasks[0] == (TEST_READY_A | TEST_READY_B), "preemptive_ready", "due tasks set ready");
+	TEST_check(TEST_takePendSV() && currentTask == &sysTasks[SCHED_TASK_ID_taskB], "preemptive_ready", "highest priority picked");
+
+	SCHED_serveRelease();
+	TEST_check(readyTasks[0] == TEST_READY_A, "preemptive_ready", "served task cleared");
+	TEST_check(TEST_takePendSV() && currentTask == &sysTasks[SCHED_TASK_ID_taskA], "preemptive_ready", "next ready task picked");
+
+	taskAAction = TEST_tickTwice;
+	SCHED_serveRelease();
+	TEST_check(readyTasks[0] == TEST_READY_A && sysTasks[SCHED_TASK_ID_taskA].ready, "preemptive_ready", "release during run kept");
+
+	taskAAction = 0;
+	TEST_takePendSV();
+	SCHED_serveRelease();
+	TEST_check(readyTasks[0] == 0, "preemptive_ready", "no task ready");
+	TEST_check(TEST_takePendSV() && currentTask == &idleTask, "preemptive_ready", "idle picked");
+
+	TEST_tick();
+	TEST_check(readyTasks[0] == TEST_READY_B && TEST_takePendSV(), "preemptive_ready", "release preempts idle");
+	SCHED_serveRelease();
+	TEST_takePendSV();
+
+	/* A released at tick 5 runs until B is released at tick 7 */
+	TEST_tick();
+	TEST_takePendSV();
+	taskAAction = TEST_tickToB;
+	SCHED_serveRelease();
+	TEST_check(preemptedByB, "preemptive_ready", "higher priority release preempts running task");
+	TEST_takePendSV();
+	taskAAction = 0;
+	TEST_check(currentTask == &sysTasks[SCHED_TASK_ID_taskB], "preemptive_ready", "preempting task picked");
+	SCHED_serveRelease();
+	TEST_takePendSV();
+	SCHED_serveRelease();
+
+	TEST_check(SCHED_activateTask(SCHED_TASK_ID_taskE) == status_Ok && readyTasks[0] == TEST_READY_E,
+			"preemptive_ready", "activated event task set ready");
+	TEST_check(TEST_takePendSV() && currentTask == &sysTasks[SCHED_TASK_ID_taskE], "preemptive_ready", "event task picked");
+	SCHED_serveRelease();
+	TEST_takePendSV();
+
+	TEST_check(strcmp(runLog, "1BA3A4B5A7BAE") == 0, "preemptive_ready", "runs in priority order");
+}
+
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+/* Run of A never returns within the hang timeout, ticks come while it runs */
+static void TEST_hangTicks (void)
+{
+	uint32_t local_tickLoop;
+
+	for (local_tickLoop = 0; local_tickLoop <= HANG_TICKS; local_tickLoop++)
+	{
+		TEST_tick();
+	}
+}
+
+/* Supervisor checks every running task on the tick, a preempted run still runs */
+static void TEST_preemptiveSupervision (void)
+{
+	uint32_t misses = 0;
+
+	TEST_preemptiveStart();
+	TEST_tick();
+	TEST_takePendSV();
+	SCHED_serveRelease();
+	TEST_takePendSV();
+
+	taskAAction = TEST_hangTicks;
+	SCHED_serveRelease();
+	TEST_check(SCHED_getDeadlineMisses(SCHED_TASK_ID_taskA, &misses) == status_Ok && misses == 1,
+			"preemptive_supervision", "missed deadline counted once");
+	TEST_resetTask("preemptive_supervision");
+}
+#endif
+
+/* Tick handler that records the ready bitmap while B waits in a delay */
+static void TEST_observeWait (void)
+{
+	SCHED_tick();
+
+	if (sysTasks[SCHED_TASK_ID_taskB].waiting)
+	{
+		waitTicks++;
+		readyWhileWaiting |= readyTasks[0] & TEST_READY_B;
+	}
+}
+
+static void TEST_delayTwoTicks (void)
+{
+	TEST_check(SCHED_delayUs(2 * TICK_USEC) == status_Ok, "preemptive_delay", "delay made");
+}
+
+/* A task in a delay waits in the wait queue out of the ready bitmap until its wake tick */
+static void TEST_preemptiveDelay (void)
+{
+	TEST_preemptiveStart();
+	SYSTICK_setCallback(TEST_observeWait);
+	waitTicks = 0;
+	readyWhileWaiting = 0;
+
+	TEST_tick();
+	TEST_takePendSV();
+	taskBAction = TEST_delayTwoTicks;
+	SCHED_serveRelease();
+
+	TEST_check(waitTicks == 1 && readyWhileWaiting == 0, "preemptive_delay", "waiting task not ready");
+	TEST_check(waitQueue == 0 && !sysTasks[SCHED_TASK_ID_taskB].waiting, "preemptive_delay", "task woken at its tick");
+	TEST_check(tickCount == 3, "preemptive_delay", "delay lasts its ticks");
+}
+#endif
+
+#if SCHED_IDLE_MODE == SCHED_IDLE_TICKLESS
+/* Core sleeps from a due tick to the next one, releases stay on their ticks and time base counts the slept ticks */
+static void TEST_ticklessIdle (void)
+{
+	uint64_t nowUs;
+
+	TEST_schedSetUp();
+	TEST_schedRun(12);
+
+	TEST_check(strcmp(runLog, "1AB3A4B5A7AB9A10B11A") == 0, "tickless_idle", "releases on their ticks");
+	SCHED_getTimestampUs(&nowUs);
+	TEST_check(nowUs / TICK_USEC == 13, "tickless_idle", "slept ticks counted");
+	TEST_check(SIM_getSleepCycles() > SIM_getCycles() / 10 * 9, "tickless_idle", "core sleeps between due ticks");
+}
+#endif
+
+int main (void)
+{
+	TEST_taskTable();
+	TEST_taskOffsets();
+	TEST_timeBaseWrap();
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE
+	TEST_eventTask();
+	TEST_cpuLoad();
+	TEST_eventInOverload();
+	TEST_delayPending();
+#endif
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE && SCHED_OFFSETS_MODE == SCHED_OFFSETS_TABLE
+	TEST_taskPool();
+	TEST_catchUp();
+#endif
+#if SCHED_MODE == SCHED_MODE_COOPERATIVE && SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	TEST_supervision();
+#endif
+#if SCHED_MODE == SCHED_MODE_PREEMPTIVE
+	TEST_preemptiveReady();
+	TEST_preemptiveDelay();
+#if SCHED_SUPERVISION == SCHED_SUPERVISION_ENABLE
+	TEST_preemptiveSupervision();
+#endif
+#endif
+#if SCHED_IDLE_MODE == SCHED_IDLE_TICKLESS
+	TEST_ticklessIdle();
+#endif
+
+	TEST_report(SCHED_TEST_NAME "_checks", checks, "checks");
+	TEST_report(SCHED_TEST_NAME "_failures", failures, "checks");
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,94 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: HOST                                  */
+/* Component: TEST                              */
+/* File Name: SCHED_TEST_cfg.h                  */
+/************************************************/
+
+/*
+  Scheduler configurations of SCHED_TEST.c, the host Makefile forces this file in with
+  SCHED_TEST_<variant> defined. It has the guard of SCHEDULER_cfg.h so it takes its place.
+*/
+
+#ifndef SCHEDULER_CFG_H
+#define SCHEDULER_CFG_H
+
+#define MAX_TASKS_NUMBER  3
+#define TICK_USEC         1000
+
+#if defined(SCHED_TEST_TICKLESS)
+#define SCHED_TEST_NAME       "sched_tickless"
+#define SCHED_IDLE_MODE       SCHED_IDLE_TICKLESS
+#define SCHED_MODE            SCHED_MODE_COOPERATIVE
+#define SCHED_CATCHUP_POLICY  SCHED_CATCHUP_RUN_ALL
+#define SCHED_SUPERVISION     SCHED_SUPERVISION_DISABLE
+#elif defined(SCHED_TEST_PREEMPTIVE)
+#define SCHED_TEST_NAME       "sched_preemptive"
+#define SCHED_IDLE_MODE       SCHED_IDLE_SLEEP
+#define SCHED_MODE            SCHED_MODE_PREEMPTIVE
+#define SCHED_CATCHUP_POLICY  SCHED_CATCHUP_RUN_ALL
+#define SCHED_SUPERVISION     SCHED_SUPERVISION_ENABLE
+#elif defined(SCHED_TEST_SKIP)
+#define SCHED_TEST_NAME       "sched_skip"
+#define SCHED_IDLE_MODE       SCHED_IDLE_SLEEP
+#define SCHED_MODE            SCHED_MODE_COOPERATIVE
+#define SCHED_CATCHUP_POLICY  SCHED_CATCHUP_SKIP
+#define SCHED_SUPERVISION     SCHED_SUPERVISION_DISABLE
+#elif defined(SCHED_TEST_COALESCE)
+#define SCHED_TEST_NAME       "sched_coalesce"
+#define SCHED_IDLE_MODE       SCHED_IDLE_SLEEP
+#define SCHED_MODE            SCHED_MODE_COOPERATIVE
+#define SCHED_CATCHUP_POLICY  SCHED_CATCHUP_COALESCE
+#define SCHED_SUPERVISION     SCHED_SUPERVISION_DISABLE
+#elif defined(SCHED_TEST_SUPERVISED)
+#define SCHED_TEST_NAME       "sched_supervised"
+#define SCHED_IDLE_MODE       SCHED_IDLE_SLEEP
+#define SCHED_MODE            SCHED_MODE_COOPERATIVE
+#define SCHED_CATCHUP_POLICY  SCHED_CATCHUP_RUN_ALL
+#define SCHED_SUPERVISION     SCHED_SUPERVISION_ENABLE
+#elif defined(SCHED_TEST_OFFSETS_AUTO)
+#define SCHED_TEST_NAME       "sched_offsets_auto"
+#define SCHED_IDLE_MODE       SCHED_IDLE_SLEEP
+#define SCHED_MODE            SCHED_MODE_COOPERATIVE
+#define SCHED_CATCHUP_POLICY  SCHED_CATCHUP_RUN_ALL
+#define SCHED_SUPERVISION     SCHED_SUPERVISION_DISABLE
+#define SCHED_OFFSETS_MODE    SCHED_OFFSETS_AUTO
+#define SCHED_TEST_PERIOD_B   4
+#else
+#error "SCHED_TEST_<variant> shall select a configuration"
+#endif
+
+/* Variants take table offsets and B every 3 ticks unless they set them */
+#ifndef SCHED_OFFSETS_MODE
+#define SCHED_OFFSETS_MODE    SCHED_OFFSETS_TABLE
+#endif
+#ifndef SCHED_TEST_PERIOD_B
+#define SCHED_TEST_PERIOD_B   3
+#endif
+
+/* A every 2 ticks, B every SCHED_TEST_PERIOD_B ticks with the highest priority and a deadline of 2 ticks, E is an event task */
+#define SCHED_TASKS_LIST \
+		SCHED_TASK(taskA, TEST_taskA, 2000, 0, 1, 100, 0) \
+		SCHED_TASK(taskB, TEST_taskB, SCHED_TEST_PERIOD_B * TICK_USEC, 0, 0, 100, 2000) \
+		SCHED_TASK(taskE, TEST_taskE, 0, 0, 2, 100, 0)
+
+#define SCHED_TASK(name, runnable, periodUs, offsetUs, priority, execUs, deadlineUs) SCHED_TASK_ID_##name,
+typedef enum
+{
+	SCHED_TASKS_LIST
+}schedTaskId_t;
+#undef SCHED_TASK
+
+#define SCHED_MAX_HYPERPERIOD_TICKS  1000
+#define SCHED_DYNAMIC_TASKS_NUMBER   2
+#define SCHED_TASK_STATS             SCHED_STATS_ENABLE
+#define SCHED_STACK_SIZE_WORDS       128
+
+#define SCHED_HANG_TIMEOUT_USEC      5000
+#define SCHED_WATCHDOG_TIMEOUT_MS    20
+#define SCHED_RESET_BKP_REGISTER     1
+
+
+#endif
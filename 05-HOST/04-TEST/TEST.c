@@ -0,0 +1,820 @@
+/************************************************/
+/* Author: Alzahraa Elsallakh                   */
+/* Version: V01                                 */
+/* Date: 17 Oct 2026                            */
+/* Layer: HOST                                  */
+/* Component: TEST                              */
+/* File Name: TEST.c                            */
+/************************************************/
+
+/*
+  Host unit tests of libraries and drivers on the simulated register file.
+  Scheduler tests start the scheduler of SCHEDULER_cfg.h for a number of ticks with SIM_runFor.
+  Every failed check prints "error: <test>: <check>", the last lines are
+  "<name> <value> <unit>" and exit status is not zero if a check failed so the host build fails.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "SPSC_QUEUE.h"
+
+#include "SYSTICK.h"
+#include "FLASH.h"
+#include "RCC.h"
+#include "RCC_cfg.h"
+#include "SCHEDULER.h"
+#include "SCHEDULER_cfg.h"
+#include "SWTIMER.h"
+#include "GOVERNOR.h"
+#include "GOVERNOR_cfg.h"
+
+#include "SIM.h"
+
+#define TEST_QUEUE_CAPACITY  8
+
+/* Tick that needs the divided counter clock at 72 MHz and the rest of it left when restarted */
+#define TEST_SYSTICK_MHZ     72
+#define TEST_TICK_USEC       1000000
+#define TEST_REST_USEC       200000
+#define TEST_STEP_CYCLES     1000
+
+/* Half cycle access enable bit of FLASH ACR */
+#define FLASH_ACR_HLFCYA_BIT 0x00000008
+
+/* Last page of medium density flash */
+#define TEST_FLASH_PAGE      0x0800FC00
+
+/* Delay made before scheduler starts, system clock is HSI 8 MHz */
+#define TEST_DELAY_USEC      5000
+#define TEST_HSI_MHZ         8
+
+/* Scheduler tick of SCHEDULER_cfg.h at HSI and runs recorded by a scheduler test */
+#define TEST_TICK_CYCLES     ((simCycles_t)TICK_USEC * TEST_HSI_MHZ)
+#define TEST_LOG_SIZE        128
+
+/* Timers of a software timer test, a periodic one expires every tick and the long one after a turn of the wheel */
+#define TEST_TIMERS          3
+#define TEST_TIMER_SHORT     0
+#define TEST_TIMER_TICK      1
+#define TEST_TIMER_LONG      2
+#define TEST_LONG_TICKS      70
+
+/* Index of PLL 72 MHz in GOVERNOR_PROFILES_LIST */
+#define TEST_FASTEST_PROFILE 2
+
+/* Time scheduler takes around a run it measures */
+#define TEST_STATS_SLACK_USEC 1000
+
+static uint32_t checks;
+static uint32_t failures;
+
+static volatile uint32_t sysTickCount;
+
+static uint32_t clockPreChanges;
+static uint32_t clockPostChanges;
+static uint32_t clockPreFreq;
+static uint32_t clockPostPrimask;
+static uint32_t tickMismatches;
+static uint32_t hsiTicks;
+
+static char runLog[TEST_LOG_SIZE];
+static uint32_t runLogLength;
+static uint32_t runLogTick;
+static void (*task1Action)(void);
+
+static uint32_t timerIds[TEST_TIMERS];
+static uint32_t timerExpiries[TEST_TIMERS];
+static uint32_t timerLastTick[TEST_TIMERS];
+static uint32_t timerTask;
+
+static void TEST_report (const char * name, uint32_t value, const char * unit)
+{
+	printf("%s %u %s\n", name, value, unit);
+}
+
+static void TEST_check (uint32_t condition, const char * test, const char * check)
+{
+	checks++;
+	if (!condition)
+	{
+		failures++;
+		fprintf(stderr, "error: %s: %s\n", test, check);
+	}
+}
+
+/* Only a power of 2 capacity and valid memory make a queue */
+static void TEST_spscInit (void)
+{
+	uint32_t buffer[TEST_QUEUE_CAPACITY];
+	spscQueue_t queue;
+
+	TEST_check(SPSC_init(&queue, buffer, sizeof(uint32_t), 6) == status_Nok, "spsc_init", "capacity 6 rejected");
+	TEST_check(SPSC_init(&queue, buffer, sizeof(uint32_t), 3) == status_Nok, "spsc_init", "capacity 3 rejected");
+	TEST_check(SPSC_init(&queue, buffer, sizeof(uint32_t), 0) == status_Nok, "spsc_init", "capacity 0 rejected");
+	TEST_check(SPSC_init(&queue, 0, sizeof(uint32_t), 8) == status_Nok, "spsc_init", "null buffer rejected");
+	TEST_check(SPSC_init(&queue, buffer, 0, 8) == status_Nok, "spsc_init", "element size 0 rejected");
+	TEST_check(SPSC_init(0, buffer, sizeof(uint32_t), 8) == status_Nok, "spsc_init", "null queue rejected");
+	TEST_check(SPSC_init(&queue, buffer, sizeof(uint32_t), 1) == status_Ok, "spsc_init", "capacity 1 accepted");
+	TEST_check(SPSC_init(&queue, buffer, sizeof(uint32_t), TEST_QUEUE_CAPACITY) == status_Ok, "spsc_init", "capacity 8 accepted");
+}
+
+/* Every slot is used, a full queue rejects and an empty one returns nothing */
+static void TEST_spscFullEmpty (void)
+{
+	uint32_t buffer[TEST_QUEUE_CAPACITY];
+	spscQueue_t queue;
+	uint32_t element;
+	uint32_t count;
+	uint32_t ordered = 1;
+
+	SPSC_init(&queue, buffer, sizeof(uint32_t), TEST_QUEUE_CAPACITY);
+
+	TEST_check(SPSC_dequeue(&queue, &element) == status_Nok, "spsc_full_empty", "new queue is empty");
+	SPSC_getCount(&queue, &count);
+	TEST_check(count == 0, "spsc_full_empty", "new queue counts 0");
+
+	for (element = 0; element < TEST_QUEUE_CAPACITY; element++)
+	{
+		TEST_check(SPSC_enqueue(&queue, &element) == status_Ok, "spsc_full_empty", "enqueue up to capacity");
+	}
+	element = 100;
+	TEST_check(SPSC_enqueue(&queue, &element) == status_Nok, "spsc_full_empty", "full queue rejects");
+	SPSC_getCount(&queue, &count);
+	TEST_check(count == TEST_QUEUE_CAPACITY, "spsc_full_empty", "full queue counts capacity");
+
+	for (count = 0; count < TEST_QUEUE_CAPACITY; count++)
+	{
+		if (SPSC_dequeue(&queue, &element) != status_Ok || element != count)
+		{
+			ordered = 0;
+		}
+	}
+	TEST_check(ordered, "spsc_full_empty", "elements dequeued in order");
+	TEST_check(SPSC_dequeue(&queue, &element) == status_Nok, "spsc_full_empty", "emptied queue is empty");
+	TEST_check(SPSC_getCount(&queue, 0) == status_Nok, "spsc_full_empty", "null count rejected");
+}
+
+/* Free running indices keep count and order when they wrap past 2^32 */
+static void TEST_spscIndexWrap (void)
+{
+	uint32_t buffer[TEST_QUEUE_CAPACITY];
+	spscQueue_t queue;
+	uint32_t element;
+	uint32_t count;
+	uint32_t ordered = 1;
+
+	SPSC_init(&queue, buffer, sizeof(uint32_t), TEST_QUEUE_CAPACITY);
+	queue.head = 0xFFFFFFFD;
+	queue.tail = 0xFFFFFFFD;
+
+	for (element = 0; element < TEST_QUEUE_CAPACITY; element++)
+	{
+		SPSC_enqueue(&queue, &element);
+	}
+	TEST_check(queue.head == TEST_QUEUE_CAPACITY - 3, "spsc_index_wrap", "head wrapped");
+	SPSC_getCount(&queue, &count);
+	TEST_check(count == TEST_QUEUE_CAPACITY, "spsc_index_wrap", "wrapped queue counts capacity");
+	element = 100;
+	TEST_check(SPSC_enqueue(&queue, &element) == status_Nok, "spsc_index_wrap", "wrapped full queue rejects");
+
+	for (count = 0; count < TEST_QUEUE_CAPACITY; count++)
+	{
+		if (SPSC_dequeue(&queue, &element) != status_Ok || element != count)
+		{
+			ordered = 0;
+		}
+	}
+	TEST_check(ordered, "spsc_index_wrap", "elements dequeued in order across wrap");
+	TEST_check(SPSC_dequeue(&queue, &element) == status_Nok, "spsc_index_wrap", "wrapped queue emptied");
+}
+
+/* A batch crossing the buffer end goes to its last slots then to its first ones */
+static void TEST_spscBatchSplit (void)
+{
+	uint32_t buffer[TEST_QUEUE_CAPACITY];
+	uint32_t batch[5] = {10, 11, 12, 13, 14};
+	uint32_t out[5] = {0};
+	spscQueue_t queue;
+	uint32_t count;
+
+	SPSC_init(&queue, buffer, sizeof(uint32_t), TEST_QUEUE_CAPACITY);
+	queue.head = TEST_QUEUE_CAPACITY - 2;
+	queue.tail = TEST_QUEUE_CAPACITY - 2;
+
+	TEST_check(SPSC_enqueueBatch(&queue, batch, 5, &count) == status_Ok && count == 5, "spsc_batch_split", "batch enqueued");
+	TEST_check(buffer[6] == 10 && buffer[7] == 11, "spsc_batch_split", "first part at buffer end");
+	TEST_check(buffer[0] == 12 && buffer[1] == 13 && buffer[2] == 14, "spsc_batch_split", "second part at buffer start");
+
+	TEST_check(SPSC_dequeueBatch(&queue, out, 5, &count) == status_Ok && count == 5, "spsc_batch_split", "batch dequeued");
+	TEST_check(out[0] == 10 && out[1] == 11 && out[2] == 12 && out[3] == 13 && out[4] == 14,
+			"spsc_batch_split", "batch dequeued in order");
+}
+
+/* A batch larger than free slots or elements is cut to them */
+static void TEST_spscPartialBatch (void)
+{
+	uint32_t buffer[TEST_QUEUE_CAPACITY];
+	uint32_t batch[TEST_QUEUE_CAPACITY + 2];
+	spscQueue_t queue;
+	uint32_t count;
+
+	for (count = 0; count < TEST_QUEUE_CAPACITY + 2; count++)
+	{
+		batch[count] = count;
+	}
+
+	SPSC_init(&queue, buffer, sizeof(uint32_t), TEST_QUEUE_CAPACITY);
+
+	SPSC_enqueueBatch(&queue, batch, TEST_QUEUE_CAPACITY - 2, &count);
+	TEST_check(SPSC_enqueueBatch(&queue, batch, 5, &count) == status_Ok && count == 2, "spsc_partial_batch", "nearly full queue takes 2");
+	TEST_check(SPSC_enqueueBatch(&queue, batch, 5, &count) == status_Nok && count == 0, "spsc_partial_batch", "full queue takes none");
+
+	TEST_check(SPSC_dequeueBatch(&queue, batch, TEST_QUEUE_CAPACITY + 2, &count) == status_Ok && count == TEST_QUEUE_CAPACITY,
+			"spsc_partial_batch", "dequeue cut to elements");
+	TEST_check(batch[TEST_QUEUE_CAPACITY - 3] == TEST_QUEUE_CAPACITY - 3 && batch[TEST_QUEUE_CAPACITY - 2] == 0 &&
+			batch[TEST_QUEUE_CAPACITY - 1] == 1, "spsc_partial_batch", "partial batch follows in order");
+	TEST_check(SPSC_dequeueBatch(&queue, batch, 1, &count) == status_Nok && count == 0, "spsc_partial_batch", "empty queue gives none");
+}
+
+static void TEST_sysTickCallback (void)
+{
+	sysTickCount++;
+}
+
+/* Cycles until the next SysTick exception, 0 if none comes within limit */
+static simCycles_t TEST_cyclesToTick (simCycles_t limit)
+{
+	uint32_t count = sysTickCount;
+
+	SIM_resetCounters();
+	while (sysTickCount == count && SIM_getCycles() < limit)
+	{
+		SIM_advance(TEST_STEP_CYCLES);
+	}
+
+	return (sysTickCount != count) ? SIM_getCycles() : 0;
+}
+
+/* Counter restarted with the rest of a tick, as scheduler does on clock change and tickless wake */
+static void TEST_sysTickRestart (void)
+{
+	simCycles_t restCycles;
+	simCycles_t tickCycles;
+	uint32_t elapsedUs;
+
+	SYSTICK_init();
+	SYSTICK_setCallback(TEST_sysTickCallback);
+
+	TEST_check(SYSTICK_setTimeUs(TEST_TICK_USEC, TEST_SYSTICK_MHZ) == status_Ok, "systick_restart", "tick fits divided counter");
+	TEST_check(SYSTICK_setPartialTimeUs(TEST_REST_USEC, TEST_SYSTICK_MHZ) == status_Ok, "systick_restart", "rest set");
+	SYSTICK_start();
+	TEST_check(SYSTICK_setPartialTimeUs(TEST_TICK_USEC, TEST_SYSTICK_MHZ) == status_Ok, "systick_restart", "next ticks set");
+
+	SYSTICK_getElapsedUs(&elapsedUs, TEST_SYSTICK_MHZ);
+	TEST_check(elapsedUs >= TEST_TICK_USEC - TEST_REST_USEC && elapsedUs < TEST_TICK_USEC - TEST_REST_USEC + 10,
+			"systick_restart", "elapsed time of restarted tick");
+
+	restCycles = TEST_cyclesToTick(2ULL * TEST_TICK_USEC * TEST_SYSTICK_MHZ);
+	TEST_check(restCycles >= (simCycles_t)TEST_REST_USEC * TEST_SYSTICK_MHZ - TEST_STEP_CYCLES &&
+			restCycles <= (simCycles_t)TEST_REST_USEC * TEST_SYSTICK_MHZ + TEST_STEP_CYCLES, "systick_restart", "rest of tick lasts its time");
+
+	SIM_advance(TEST_REST_USEC * TEST_SYSTICK_MHZ);
+	SYSTICK_getElapsedUs(&elapsedUs, TEST_SYSTICK_MHZ);
+	TEST_check(elapsedUs >= TEST_REST_USEC && elapsedUs < TEST_REST_USEC + 10, "systick_restart", "elapsed time of next tick");
+
+	/* Prescaler of the running counter is kept even when the new time alone would not need it */
+	TEST_check(SYSTICK_setTimeUs(TEST_REST_USEC, TEST_SYSTICK_MHZ) == status_Ok, "systick_restart", "short time on running counter");
+
+	tickCycles = TEST_cyclesToTick(2ULL * TEST_TICK_USEC * TEST_SYSTICK_MHZ);
+	TEST_check(tickCycles >= (simCycles_t)(TEST_TICK_USEC - TEST_REST_USEC) * TEST_SYSTICK_MHZ - TEST_STEP_CYCLES &&
+			tickCycles <= (simCycles_t)(TEST_TICK_USEC - TEST_REST_USEC) * TEST_SYSTICK_MHZ + TEST_STEP_CYCLES,
+			"systick_restart", "running tick ends at its boundary");
+
+	tickCycles = TEST_cyclesToTick(2ULL * TEST_TICK_USEC * TEST_SYSTICK_MHZ);
+	TEST_check(tickCycles >= (simCycles_t)TEST_REST_USEC * TEST_SYSTICK_MHZ - TEST_STEP_CYCLES &&
+			tickCycles <= (simCycles_t)TEST_REST_USEC * TEST_SYSTICK_MHZ + TEST_STEP_CYCLES, "systick_restart", "next period lasts new time");
+
+	SYSTICK_stop();
+}
+
+/* Buffer programming fails on a programmed half word and the next programming still works */
+static void TEST_flashProgramBuffer (void)
+{
+	const uint16_t halfWords[4] = {0x1111, 0x2222, 0x3333, 0x4444};
+	const uint16_t other[4] = {0x5555, 0x6666, 0x7777, 0x8888};
+	const uint32_t words[2] = {0x12345678, 0x9ABCDEF0};
+
+	TEST_check(FLASH_programBuffer(TEST_FLASH_PAGE, halfWords, 4) == status_Nok, "flash_program_buffer", "locked flash rejected");
+
+	FLASH_unlock();
+	SIM_advance(1);
+	FLASH_erasePage(TEST_FLASH_PAGE);
+
+	TEST_check(FLASH_programBuffer(TEST_FLASH_PAGE, 0, 4) == status_Nok, "flash_program_buffer", "null buffer rejected");
+	TEST_check(FLASH_programWordBuffer(TEST_FLASH_PAGE, 0, 1) == status_Nok, "flash_program_buffer", "null word buffer rejected");
+	TEST_check(FLASH_programBuffer(TEST_FLASH_PAGE + 1, halfWords, 4) == status_Nok, "flash_program_buffer", "odd address rejected");
+
+	TEST_check(FLASH_programBuffer(TEST_FLASH_PAGE, halfWords, 4) == status_Ok, "flash_program_buffer", "erased half words programmed");
+	TEST_check(*(volatile uint16_t *)MEM_ADDRESS(TEST_FLASH_PAGE + 6) == 0x4444, "flash_program_buffer", "last half word programmed");
+
+	TEST_check(FLASH_programBuffer(TEST_FLASH_PAGE, other, 4) == status_Nok, "flash_program_buffer", "programmed half words fail");
+	TEST_check(*(volatile uint16_t *)MEM_ADDRESS(TEST_FLASH_PAGE) == 0x1111, "flash_program_buffer", "failed half word kept");
+
+	TEST_check(FLASH_programBuffer(TEST_FLASH_PAGE + 8, other, 4) == status_Ok, "flash_program_buffer", "programming works after failure");
+	TEST_check(FLASH_programWordBuffer(TEST_FLASH_PAGE + 16, words, 2) == status_Ok, "flash_program_buffer", "words programmed");
+	TEST_check(*(volatile uint16_t *)MEM_ADDRESS(TEST_FLASH_PAGE + 20) == 0xDEF0 &&
+			*(volatile uint16_t *)MEM_ADDRESS(TEST_FLASH_PAGE + 22) == 0x9ABC, "flash_program_buffer", "word lower half first");
+	TEST_check(FLASH_programWord(TEST_FLASH_PAGE + 16, 0) == status_Nok, "flash_program_buffer", "programmed word fails");
+	TEST_check(FLASH_programWord(TEST_FLASH_PAGE + 24, 0xCAFEBABE) == status_Ok, "flash_program_buffer", "word works after failure");
+
+	FLASH_lock();
+}
+
+/* Bring up raises wait states before it selects PLL, and falls back to HSI once a clock times out */
+static void TEST_rccBringUp (void)
+{
+	uint32_t * ACR = MEM_ADDRESS(0x40022000);
+	uint32_t state;
+	uint32_t freq;
+	uint32_t polls = 0;
+
+	SIM_init();
+
+	RCC_selectPLL_Source(PLL_SRC_HSE);
+	RCC_setPLL_Multiplication(PLL_MUL_9);
+	RCC_setAPB1_Prescaler(SCALER_APB1_2);
+	TEST_check(RCC_startBringUp(SYSTEM_CLOCK_PLL, 0) == status_Ok, "rcc_bring_up", "started");
+	do
+	{
+		SIM_advance(TEST_STEP_CYCLES);
+		RCC_pollBringUp(&state);
+	} while (state == RCC_BRINGUP_HSE || state == RCC_BRINGUP_PLL);
+
+	RCC_getSystemFrequency(&freq);
+	TEST_check(state == RCC_BRINGUP_DONE && freq == 72000000, "rcc_bring_up", "PLL 72 MHz selected");
+	TEST_check((*ACR & 0x7) == FLASH_LATENCY_2, "rcc_bring_up", "wait states raised for 72 MHz");
+
+	RCC_selectSystemClock(SYSTEM_CLOCK_HSI);
+	RCC_setClockStatus(SET_PLL_STATUS, STATE_DISABLE);
+	RCC_setClockStatus(SET_HSE_STATUS, STATE_DISABLE);
+	SIM_advance(TEST_STEP_CYCLES);
+
+	/* Crystal never gets ready as time does not pass */
+	RCC_startBringUp(SYSTEM_CLOCK_HSE, 0);
+	do
+	{
+		RCC_pollBringUp(&state);
+		polls++;
+	} while (state == RCC_BRINGUP_HSE);
+
+	RCC_getSystemFrequency(&freq);
+	TEST_check(state == RCC_BRINGUP_FAILED && freq == 8000000, "rcc_bring_up", "HSI selected on timeout");
+	TEST_check(polls == RCC_BRINGUP_TIMEOUT_US / RCC_BRINGUP_POLL_PERIOD_US, "rcc_bring_up", "timeout counted in poll periods");
+}
+
+/* Half cycle access follows the clock while it is HSI or HSE undivided up to 8 MHz */
+static void TEST_flashHalfCycle (void)
+{
+	uint32_t * ACR = MEM_ADDRESS(0x40022000);
+
+	SIM_init();
+
+	TEST_check(FLASH_trackSystemClock() == status_Ok, "flash_half_cycle", "tracking started");
+	TEST_check(*ACR & FLASH_ACR_HLFCYA_BIT, "flash_half_cycle", "used on HSI 8 MHz");
+
+	RCC_setAHB_Prescaler(SCALER_AHB_2);
+	TEST_check(!(*ACR & FLASH_ACR_HLFCYA_BIT), "flash_half_cycle", "not used with AHB divided");
+	TEST_check(FLASH_setHalfCycle(FLASH_HALF_CYCLE_ENABLE) == status_Nok, "flash_half_cycle", "refused with AHB divided");
+	RCC_setAHB_Prescaler(SCALER_AHB_1);
+
+	RCC_setPLL_Multiplication(PLL_MUL_2);
+	RCC_setClockStatus(SET_PLL_STATUS, STATE_ENABLE);
+	RCC_selectSystemClock(SYSTEM_CLOCK_PLL);
+	TEST_check(!(*ACR & FLASH_ACR_HLFCYA_BIT), "flash_half_cycle", "not used on PLL 8 MHz");
+	TEST_check(FLASH_setHalfCycle(FLASH_HALF_CYCLE_ENABLE) == status_Nok, "flash_half_cycle", "refused on PLL");
+
+	TEST_check(RCC_applyProfile(RCC_PROFILE_ID_PLL_72MHZ) == status_Ok && (*ACR & 0x7) == FLASH_LATENCY_2,
+			"flash_half_cycle", "wait states raised for 72 MHz");
+	TEST_check(RCC_applyProfile(RCC_PROFILE_ID_HSI_8MHZ) == status_Ok && (*ACR & 0x7) == FLASH_LATENCY_0 &&
+			(*ACR & FLASH_ACR_HLFCYA_BIT), "flash_half_cycle", "wait states lowered and half cycle back on HSI");
+}
+
+static void TEST_clockChanged (uint32_t event, const rccClocks_t * clocks)
+{
+	if (event == RCC_CLOCK_PRE_CHANGE)
+	{
+		clockPreChanges++;
+		clockPreFreq = clocks->ahbFreq;
+	}
+	else
+	{
+		clockPostChanges++;
+	}
+}
+
+/* Applying a profile notifies subscribers before and after every step, the last one with its final clocks */
+static void TEST_rccProfileNotification (void)
+{
+	const uint32_t profiles[4] = {RCC_PROFILE_ID_PLL_72MHZ, RCC_PROFILE_ID_PLL_36MHZ, RCC_PROFILE_ID_PLL_72MHZ, RCC_PROFILE_ID_HSI_8MHZ};
+	const uint32_t freqs[4] = {72000000, 36000000, 72000000, 8000000};
+	uint32_t local_profileLoop;
+	uint32_t freq;
+
+	RCC_registerClockCallback(TEST_clockChanged);
+
+	for (local_profileLoop = 0; local_profileLoop < 4; local_profileLoop++)
+	{
+		clockPreChanges = 0;
+		clockPostChanges = 0;
+
+		TEST_check(RCC_applyProfile(profiles[local_profileLoop]) == status_Ok, "rcc_profile_notification", "profile applied");
+		RCC_getSystemFrequency(&freq);
+		TEST_check(clockPreChanges >= 1 && clockPreChanges == clockPostChanges, "rcc_profile_notification", "notifications paired");
+		TEST_check(clockPreFreq == freqs[local_profileLoop] && freq == freqs[local_profileLoop],
+				"rcc_profile_notification", "final clocks announced");
+	}
+
+	clockPreChanges = 0;
+	clockPostChanges = 0;
+	RCC_applyProfile(RCC_PROFILE_ID_HSI_8MHZ);
+	TEST_check(clockPreChanges == 0 && clockPostChanges == 0, "rcc_profile_notification", "same profile not notified");
+
+	RCC_unregisterClockCallback(TEST_clockChanged);
+}
+
+/* Runs of the scheduler, every run adds its task letter and a tick number when the tick changes */
+static void TEST_logRun (char task)
+{
+	uint64_t nowUs;
+	uint32_t tick;
+
+	SCHED_getTimestampUs(&nowUs);
+	tick = (uint32_t)(nowUs / TICK_USEC);
+
+	if (tick != runLogTick && runLogLength < TEST_LOG_SIZE)
+	{
+		runLogLength += snprintf(&runLog[runLogLength], TEST_LOG_SIZE - runLogLength, "%u", tick);
+		runLogTick = tick;
+	}
+	if (runLogLength < TEST_LOG_SIZE - 1)
+	{
+		runLog[runLogLength++] = task;
+		runLog[runLogLength] = 0;
+	}
+}
+
+/* Runnables of the task table, they run when a test starts scheduler */
+void task1Runnable (void)
+{
+	TEST_logRun('A');
+	if (task1Action)
+	{
+		task1Action();
+	}
+}
+
+void task2Runnable (void)
+{
+	TEST_logRun('B');
+}
+
+static void TEST_taskC (void)
+{
+	TEST_logRun('C');
+}
+
+static void TEST_taskD (void)
+{
+	TEST_logRun('D');
+}
+
+/* Scheduler is initialized with an empty run log, table tasks run every tick from tick 1 */
+static void TEST_schedSetUp (void)
+{
+	SIM_init();
+	SCHED_init();
+
+	runLog[0] = 0;
+	runLogLength = 0;
+	runLogTick = 0;
+	task1Action = 0;
+}
+
+/* Scheduler runs the given ticks, the one after them is raised but not processed */
+static void TEST_schedRun (uint32_t ticks)
+{
+	SIM_runFor(ticks * TEST_TICK_CYCLES + TEST_TICK_CYCLES / 2);
+	SCHED_start();
+}
+
+/* Delay before scheduler starts is counted on SysTick and leaves time base at zero */
+static void TEST_schedDelayBeforeStart (void)
+{
+	simCycles_t delayCycles;
+	uint64_t nowUs;
+
+	SIM_init();
+	SCHED_init();
+
+	SIM_resetCounters();
+	TEST_check(SCHED_delayUs(TEST_DELAY_USEC) == status_Ok, "sched_delay_before_start", "delay made");
+	delayCycles = SIM_getCycles();
+	TEST_check(delayCycles >= (simCycles_t)TEST_DELAY_USEC * TEST_HSI_MHZ &&
+			delayCycles <= (simCycles_t)TEST_DELAY_USEC * TEST_HSI_MHZ + TEST_STEP_CYCLES,
+			"sched_delay_before_start", "delay lasts its time");
+
+	SCHED_getTimestampUs(&nowUs);
+	TEST_check(nowUs == 0, "sched_delay_before_start", "time base not moved");
+}
+
+static void TEST_recordPrimask (uint32_t event, const rccClocks_t * clocks)
+{
+	(void)clocks;
+
+	if (event == RCC_CLOCK_POST_CHANGE)
+	{
+		clockPostPrimask = CORE_GET_PRIMASK();
+	}
+}
+
+/* Scheduler clock callback run by bring up leaves interrupts held until bring up restores them */
+static void TEST_rccBringUpCriticalSection (void)
+{
+	uint32_t state;
+
+	SIM_init();
+
+	/* Registered after the scheduler so it sees PRIMASK the scheduler callback left */
+	RCC_registerClockCallback(TEST_recordPrimask);
+	clockPostPrimask = 0;
+
+	RCC_selectPLL_Source(PLL_SRC_HSE);
+	RCC_setPLL_Multiplication(PLL_MUL_9);
+	RCC_setAPB1_Prescaler(SCALER_APB1_2);
+	RCC_startBringUp(SYSTEM_CLOCK_PLL, 0);
+	do
+	{
+		SIM_advance(TEST_STEP_CYCLES);
+		RCC_pollBringUp(&state);
+	} while (state == RCC_BRINGUP_HSE || state == RCC_BRINGUP_PLL);
+
+	TEST_check(state == RCC_BRINGUP_DONE && clockPostPrimask == 1, "rcc_bring_up_critical_section", "interrupts held in clock callbacks");
+	TEST_check(CORE_GET_PRIMASK() == 0, "rcc_bring_up_critical_section", "interrupts released after bring up");
+
+	CORE_SET_PRIMASK(1);
+	RCC_pollBringUp(&state);
+	TEST_check(CORE_GET_PRIMASK() == 1, "rcc_bring_up_critical_section", "interrupts of caller kept held");
+	CORE_SET_PRIMASK(0);
+
+	RCC_unregisterClockCallback(TEST_recordPrimask);
+}
+
+/* Full tick SysTick counts on the clocks just notified, scheduler callback has already loaded it */
+static void TEST_measureTick (uint32_t event, const rccClocks_t * clocks)
+{
+	simCycles_t expectedCycles;
+	simCycles_t tickCycles;
+
+	if (event != RCC_CLOCK_POST_CHANGE)
+	{
+		return;
+	}
+
+	expectedCycles = (simCycles_t)TICK_USEC * (clocks->ahbFreq / 1000000);
+
+	/* First tick ends where the count was left, the second one lasts a full period */
+	SYSTICK_start();
+	TEST_cyclesToTick(2 * expectedCycles);
+	tickCycles = TEST_cyclesToTick(2 * expectedCycles);
+	SYSTICK_stop();
+
+	if (tickCycles + TEST_STEP_CYCLES < expectedCycles || tickCycles > expectedCycles + TEST_STEP_CYCLES)
+	{
+		tickMismatches++;
+	}
+	if (clocks->sysclkSource == SYSTEM_CLOCK_HSI)
+	{
+		hsiTicks++;
+	}
+}
+
+/* Scheduler tick follows every clock a profile switch runs on, HSI included while PLL starts */
+static void TEST_rccProfileTimeBase (void)
+{
+	const uint32_t profiles[3] = {RCC_PROFILE_ID_PLL_36MHZ, RCC_PROFILE_ID_PLL_72MHZ, RCC_PROFILE_ID_HSI_8MHZ};
+	uint32_t local_profileLoop;
+
+	SCHED_init();
+	SYSTICK_setCallback(TEST_sysTickCallback);
+
+	/* Registered after the scheduler so SysTick is already loaded for the new clocks */
+	RCC_registerClockCallback(TEST_measureTick);
+
+	for (local_profileLoop = 0; local_profileLoop < 3; local_profileLoop++)
+	{
+		tickMismatches = 0;
+		hsiTicks = 0;
+
+		TEST_check(RCC_applyProfile(profiles[local_profileLoop]) == status_Ok, "rcc_profile_time_base", "profile applied");
+		TEST_check(hsiTicks >= 1, "rcc_profile_time_base", "HSI step notified");
+		TEST_check(tickMismatches == 0, "rcc_profile_time_base", "tick lasts its time on every clock");
+	}
+
+	RCC_unregisterClockCallback(TEST_measureTick);
+}
+
+/* Tasks due at the same tick run in pool order, each one again after its period */
+static void TEST_schedReleaseOrder (void)
+{
+	uint32_t taskC;
+	uint32_t taskD;
+
+	TEST_schedSetUp();
+	TEST_check(SCHED_createTask(TEST_taskC, 2 * TICK_USEC, TICK_USEC, 0, &taskC) == status_Ok, "sched_release_order", "task C created");
+	TEST_check(SCHED_createTask(TEST_taskD, 3 * TICK_USEC, 0, 0, &taskD) == status_Ok, "sched_release_order", "task D created");
+
+	TEST_schedRun(7);
+	TEST_check(strcmp(runLog, "1ABD2ABC3AB4ABCD5AB6ABC7ABD") == 0, "sched_release_order", "tasks released in order");
+}
+
+/* Runnable of task 1 lasts a quarter of a tick */
+static void TEST_busyQuarterTick (void)
+{
+	SIM_advance(TEST_TICK_CYCLES / 4);
+}
+
+/* Statistics hold runs, execution time and start delay of every task until they are reset */
+static void TEST_schedTaskStats (void)
+{
+	taskStats_t stats;
+
+	TEST_schedSetUp();
+	task1Action = TEST_busyQuarterTick;
+	TEST_schedRun(3);
+
+	TEST_check(SCHED_getTaskStats(SCHED_TASK_ID_task1, &stats) == status_Ok, "sched_task_stats", "stats read");
+	TEST_check(stats.runs == 3 && stats.overruns == 0, "sched_task_stats", "runs counted");
+	TEST_check(stats.minExecUs >= TICK_USEC / 4 && stats.maxExecUs <= TICK_USEC / 4 + TEST_STATS_SLACK_USEC &&
+			stats.avgExecUs >= stats.minExecUs && stats.avgExecUs <= stats.maxExecUs, "sched_task_stats", "execution time measured");
+	TEST_check(stats.maxStartDelayUs <= TEST_STATS_SLACK_USEC, "sched_task_stats", "first task starts at its tick");
+
+	SCHED_getTaskStats(SCHED_TASK_ID_task2, &stats);
+	TEST_check(stats.runs == 3 && stats.minStartDelayUs >= TICK_USEC / 4, "sched_task_stats", "start delay after the task before");
+
+	TEST_check(SCHED_resetTaskStats() == status_Ok, "sched_task_stats", "stats reset");
+	SCHED_getTaskStats(SCHED_TASK_ID_task1, &stats);
+	TEST_check(stats.runs == 0 && stats.minExecUs == 0 && stats.maxExecUs == 0, "sched_task_stats", "stats cleared");
+	TEST_check(SCHED_getTaskStats(SCHED_TASKS_POOL_SIZE, &stats) == status_Nok, "sched_task_stats", "task out of pool refused");
+}
+
+/* Expiries of every test timer and the tick the last one came at */
+static void TEST_timerExpired (uint32_t timerId)
+{
+	uint64_t nowUs;
+	uint32_t local_timerLoop;
+
+	SCHED_getTimestampUs(&nowUs);
+
+	for (local_timerLoop = 0; local_timerLoop < TEST_TIMERS; local_timerLoop++)
+	{
+		if (timerIds[local_timerLoop] == timerId)
+		{
+			timerExpiries[local_timerLoop]++;
+			timerLastTick[local_timerLoop] = (uint32_t)(nowUs / TICK_USEC);
+		}
+	}
+}
+
+/* Timer service runs as a dynamic task every tick, after the table tasks */
+static void TEST_timerSetUp (void)
+{
+	uint32_t local_timerLoop;
+
+	TEST_schedSetUp();
+	SCHED_createTask(SWTIMER_runnable, TICK_USEC, 0, 0, &timerTask);
+	SWTIMER_init();
+
+	for (local_timerLoop = 0; local_timerLoop < TEST_TIMERS; local_timerLoop++)
+	{
+		timerExpiries[local_timerLoop] = 0;
+		timerLastTick[local_timerLoop] = 0;
+	}
+}
+
+/* Timers expire at the tick they were started for, a long one after the wheel turned */
+static void TEST_swTimerExpiry (void)
+{
+	TEST_timerSetUp();
+	TEST_check(SWTIMER_create(TEST_timerExpired, SWTIMER_ONE_SHOT, &timerIds[TEST_TIMER_SHORT]) == status_Ok &&
+			SWTIMER_create(TEST_timerExpired, SWTIMER_PERIODIC, &timerIds[TEST_TIMER_TICK]) == status_Ok &&
+			SWTIMER_create(TEST_timerExpired, SWTIMER_ONE_SHOT, &timerIds[TEST_TIMER_LONG]) == status_Ok,
+			"sw_timer_expiry", "timers created");
+	TEST_check(SWTIMER_start(timerIds[TEST_TIMER_SHORT], TICK_USEC / 2) == status_Nok, "sw_timer_expiry", "part of a tick refused");
+
+	SWTIMER_start(timerIds[TEST_TIMER_SHORT], 3 * TICK_USEC);
+	SWTIMER_start(timerIds[TEST_TIMER_TICK], TICK_USEC);
+	SWTIMER_start(timerIds[TEST_TIMER_LONG], TEST_LONG_TICKS * TICK_USEC);
+
+	TEST_schedRun(TEST_LONG_TICKS + 2);
+	TEST_check(timerExpiries[TEST_TIMER_SHORT] == 1 && timerLastTick[TEST_TIMER_SHORT] == 3, "sw_timer_expiry", "one shot timer expired once");
+	TEST_check(timerExpiries[TEST_TIMER_TICK] == TEST_LONG_TICKS + 2, "sw_timer_expiry", "periodic timer expired every tick");
+	TEST_check(timerExpiries[TEST_TIMER_LONG] == 1 && timerLastTick[TEST_TIMER_LONG] == TEST_LONG_TICKS,
+			"sw_timer_expiry", "timer past a turn of the wheel expired");
+
+	TEST_check(SWTIMER_delete(timerIds[TEST_TIMER_TICK]) == status_Ok && SWTIMER_restart(timerIds[TEST_TIMER_TICK]) == status_Nok,
+			"sw_timer_expiry", "deleted timer not restarted");
+}
+
+/* Timer task is held from tick 1 to tick 6 */
+static void TEST_holdTimerTask (void)
+{
+	uint64_t nowUs;
+
+	SCHED_getTimestampUs(&nowUs);
+	if (nowUs / TICK_USEC == 1)
+	{
+		SCHED_suspendTask(timerTask);
+	}
+	else if (nowUs / TICK_USEC == 6)
+	{
+		SCHED_resumeTask(timerTask);
+	}
+}
+
+/* Ticks the timer task missed are processed by its next run, so timers keep the time base */
+static void TEST_swTimerLateRun (void)
+{
+	TEST_timerSetUp();
+	SWTIMER_create(TEST_timerExpired, SWTIMER_PERIODIC, &timerIds[TEST_TIMER_TICK]);
+	SWTIMER_start(timerIds[TEST_TIMER_TICK], TICK_USEC);
+
+	task1Action = TEST_holdTimerTask;
+	TEST_schedRun(10);
+	TEST_check(timerExpiries[TEST_TIMER_TICK] == 10 && timerLastTick[TEST_TIMER_TICK] == 10, "sw_timer_late_run", "missed ticks caught up");
+}
+
+/* Runnable of task 1 is busy for most of a tick */
+static void TEST_busyMostOfTick (void)
+{
+	SIM_advance(TEST_TICK_CYCLES * 9 / 10);
+}
+
+/* Governor takes the fastest profile on a measured overload, a window not measured yet leaves the profile as it is */
+static void TEST_governorLoadWindow (void)
+{
+	uint32_t governorTask;
+	uint32_t loadPermille;
+	uint32_t profile = 0;
+	uint32_t local_runLoop;
+
+	TEST_schedSetUp();
+	SCHED_createTask(GOVERNOR_runnable, TICK_USEC, 0, 0, &governorTask);
+	TEST_check(GOVERNOR_init() == status_Ok && GOVERNOR_getProfile(&profile) == status_Ok && profile == GOVERNOR_INIT_PROFILE,
+			"governor_load_window", "initial profile taken");
+
+	task1Action = TEST_busyMostOfTick;
+	TEST_schedRun(2);
+	GOVERNOR_getProfile(&profile);
+	TEST_check(profile == TEST_FASTEST_PROFILE, "governor_load_window", "fastest profile taken on overload");
+
+	/* Scheduler initialized again starts a new window on the same clock */
+	SCHED_init();
+	TEST_check(SCHED_getCpuLoad(&loadPermille) == status_Nok, "governor_load_window", "load unknown before the first window");
+	for (local_runLoop = 0; local_runLoop <= GOVERNOR_DOWN_WINDOWS; local_runLoop++)
+	{
+		GOVERNOR_runnable();
+	}
+	GOVERNOR_getProfile(&profile);
+	TEST_check(profile == TEST_FASTEST_PROFILE, "governor_load_window", "profile kept without a measured window");
+}
+
+int main (void)
+{
+	SIM_init();
+
+	TEST_spscInit();
+	TEST_spscFullEmpty();
+	TEST_spscIndexWrap();
+	TEST_spscBatchSplit();
+	TEST_spscPartialBatch();
+	TEST_sysTickRestart();
+	TEST_flashProgramBuffer();
+	TEST_rccBringUp();
+	TEST_flashHalfCycle();
+	TEST_rccProfileNotification();
+	TEST_schedDelayBeforeStart();
+	TEST_rccBringUpCriticalSection();
+	TEST_rccProfileTimeBase();
+	TEST_schedReleaseOrder();
+	TEST_schedTaskStats();
+	TEST_swTimerExpiry();
+	TEST_swTimerLateRun();
+	TEST_governorLoadWindow();
+
+	TEST_report("test_checks", checks, "checks");
+	TEST_report("test_failures", failures, "checks");
+
+	return failures ? 1 : 0;
+}